@@ -1,16 +1,142 @@
 import sys
+import ast
+import functools
+import gc
 import importlib
+import io
+import itertools
 import queue
+import struct
+import textwrap
+import types
 
 NoResponse = object()
 
-[_, cpp_to_py, py_to_cpp, int_size] = sys.argv
-del _
-sys.argv[:] = '<snaketongs>',
+class ImportCache:
+	# a meta path finder remembering where modules were found, persisted in a directory across processes;
+	# only valid for the same python version, working directory and sys.path
+	def __init__(self, directory):
+		import os
+		import marshal
+		self.key = self.current_key()
+		key_hash = 2166136261  # FNV-1a, independent of PYTHONHASHSEED
+		for byte in self.key.encode():
+			key_hash = (key_hash ^ byte) * 16777619 % 4294967296
+		self.directory = directory
+		self.path = os.path.join(directory, 'imports-' + format(key_hash, '08x') + '.marshal')
+		try:
+			with open(self.path, 'rb') as file:
+				key, self.locations = marshal.load(file)
+			if key != self.key:
+				self.locations = {}
+		except (OSError, EOFError, ValueError, TypeError):
+			self.locations = {}
+
+	@staticmethod
+	def current_key():
+		import os
+		return repr((sys.version, os.getcwd(), sys.path))
 
-cpp_to_py = open(int(cpp_to_py), 'rb')
-py_to_cpp = open(int(py_to_cpp), 'wb')
-int_size = int(int_size)
+	def find_spec(self, name, path=None, target=None):
+		import os
+		location = self.locations.get(name)
+		if location is None:
+			return None  # the other finders will search for it
+		origin, search_locations = location
+		if not os.path.exists(origin):
+			del self.locations[name]
+			return None
+		return importlib.util.spec_from_file_location(name, origin, submodule_search_locations=search_locations)
+
+	def save(self):
+		import os
+		import marshal
+		if self.current_key() != self.key:
+			return  # sys.path has changed, the modules found since then may not be valid for the key
+		locations = {}
+		for name, module in list(sys.modules.items()):
+			spec = getattr(module, '__spec__', None)
+			if spec is not None and spec.name == name and spec.has_location and type(spec.loader).__name__ in ('SourceFileLoader', 'SourcelessFileLoader', 'ExtensionFileLoader'):
+				search_locations = spec.submodule_search_locations
+				locations[name] = spec.origin, None if search_locations is None else list(search_locations)
+		if locations == self.locations:
+			return
+		os.makedirs(self.directory, exist_ok=True)
+		temp_path = self.path + '.' + str(os.getpid())
+		with open(temp_path, 'wb') as file:
+			marshal.dump((self.key, locations), file)
+		os.replace(temp_path, self.path)
+
+def apply_options(options):
+	# key=value arguments from snaketongs::start_options (or the server command line)
+	for option in options:
+		key, _, value = option.partition('=')
+		if key == 'gc' and value == 'off':
+			gc.disable()
+		elif key == 'gc':
+			gc.set_threshold(*map(int, value.split(',')))
+			gc.enable()
+		elif key == 'import_cache':
+			import atexit
+			import importlib.util  # before the finder is installed, it needs the module itself
+			cache = ImportCache(value)
+			sys.meta_path.insert(0, cache)
+			atexit.register(cache.save)
+		else:
+			raise ValueError('Unknown option ' + option)
+
+def serve(socket_path, args):
+	# server mode: each connection gets its own forked copy of this (warmed-up) interpreter
+	import os
+	import signal
+	import socket
+	preload = [arg for arg in args if '=' not in arg]
+	options = [arg for arg in args if '=' in arg]
+	apply_options(options)
+	# keep the preloaded objects out of the gc, so that sessions do not touch (and thus copy) their memory pages;
+	# collecting while importing would only move garbage to the permanent generation
+	gc_enabled = gc.isenabled()
+	gc.disable()
+	for module in preload:
+		importlib.import_module(module)
+	gc.freeze()
+	server_pid = os.getpid()
+	signal.signal(signal.SIGCHLD, signal.SIG_IGN)  # sessions are reaped automatically
+	signal.signal(signal.SIGTERM, lambda *_: sys.exit())  # clean up the socket
+	listener = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+	listener.bind(socket_path)
+	try:
+		listener.listen()
+		while True:
+			connection, _ = listener.accept()
+			if os.fork() == 0:
+				break
+			connection.close()
+	finally:
+		if os.getpid() == server_pid:
+			os.unlink(socket_path)
+	listener.close()
+	if gc_enabled:
+		gc.enable()
+	signal.signal(signal.SIGCHLD, signal.SIG_DFL)
+	signal.signal(signal.SIGTERM, signal.SIG_DFL)
+	int_size = connection.recv(1)
+	if len(int_size) != 1:
+		os._exit(125)
+	connection = connection.detach()
+	return open(connection, 'rb'), open(os.dup(connection), 'wb'), int_size[0]
+
+if sys.argv[1:2] == ['--serve']:
+	cpp_to_py, py_to_cpp, int_size = serve(sys.argv[2], sys.argv[3:])
+else:
+	[_, cpp_to_py, py_to_cpp, int_size, *options] = sys.argv
+	del _
+	cpp_to_py = open(int(cpp_to_py), 'rb')
+	py_to_cpp = open(int(py_to_cpp), 'wb')
+	int_size = int(int_size)
+	apply_options(options)
+	del options
+sys.argv[:] = '<snaketongs>',
 
 def pack_int(i):
 	return i.to_bytes(int_size, byteorder='little', signed=True)
@@ -82,7 +208,7 @@ def return_to_cpp(data):
 	process_queue()
 	py_to_cpp.write(OCMD_RET)
 	for d in data:
-		assert type(d) is bytes
+		assert type(d) in (bytes, memoryview)
 		py_to_cpp.write(d)
 
 def throw_to_cpp(exc_obj):
@@ -111,18 +237,91 @@ def cmd_make_int(val):
 def cmd_make_bytes(size):
 	return pack_ptr(read(size)),
 
+def cmd_make_ndarray(ndim):
+	return pack_ptr(read_ndarray(ndim)),
+
+def cmd_make_columns(num_columns):
+	columns = {}
+	for _ in range(num_columns):
+		name = read_str(read_int())
+		columns[name] = read_ndarray(1)
+	return pack_ptr(columns),
+
+def cmd_make_str_list(size):
+	# end offsets (native size_t) followed by the concatenated UTF-8 strings
+	data_size = read_int()
+	ends = memoryview(read(size * struct.calcsize('N'))).cast('N')
+	data = read(data_size)
+	starts = [0, *ends[:-1]]
+	if data.isascii():
+		text = data.decode()
+		return pack_ptr([text[start:end] for start, end in zip(starts, ends)]),
+	return pack_ptr([str(data[start:end], 'utf8') for start, end in zip(starts, ends)]),
+
+def cmd_unpickle(num_buffers):
+	import pickle
+	data = read(read_int())
+	buffers = []
+	for _ in range(num_buffers):
+		buffer = bytearray(read_int())
+		read_into(buffer)
+		buffers.append(buffer)
+	return pack_ptr(pickle.loads(data, buffers=buffers)),
+
+def read_ndarray(ndim):
+	# struct format character, shape, and the items in C order
+	fmt = chr(read(1)[0])
+	shape = [read_int() for _ in range(ndim)]
+	size = struct.calcsize(fmt)
+	for extent in shape:
+		size *= extent
+	data = bytearray(size)
+	read_into(data)
+	return wrap_array(data, fmt, shape)
+
+def wrap_array(data, fmt, shape):
+	numpy = import_numpy()
+	if numpy is None:
+		if 0 in shape:
+			return memoryview(data).cast('B').cast(fmt)  # memoryview cannot have zeros in its shape, empty arrays stay flat
+		return memoryview(data).cast('B').cast(fmt, shape)
+	return numpy.frombuffer(data, dtype=fmt).reshape(shape)
+
+def cmd_map_shared(size):
+	# shared memory created by snaketongs_impl_shm_create, mapped here for as long as the array exists
+	import mmap
+	import os
+	name = read_str(read_int())
+	fmt = chr(read(1)[0])
+	fd = os.open('/dev/shm' + name, os.O_RDWR)
+	try:
+		memory = mmap.mmap(fd, size)
+	finally:
+		os.close(fd)
+	return pack_ptr(wrap_array(memory, fmt, [size // struct.calcsize(fmt)])),
+
 def cmd_make_str(size):
 	return pack_ptr(read_str(size)),
 
 def cmd_make_tuple(size):
 	return pack_ptr(tuple(read_ptr() for _ in range(size))),
 
-def cmd_make_global(size):
-	mod, name = read_str(size).rsplit('.', 1)
+def cmd_make_list(_):
+	return pack_ptr(read_values()),
+
+def cmd_make_dict(_):
+	values = read_values()
+	return pack_ptr(dict(zip(values[::2], values[1::2]))),
+
+def get_global(qualname):
+	mod, name = qualname.rsplit('.', 1)
 	imported = importlib.import_module(mod)
 	if name != '*':
 		imported = getattr(imported, name)
-	return pack_ptr(imported),
+	return imported
+
+def cmd_make_global(size):
+	return pack_ptr(get_global(read_str(size))),
 
 def cmd_make_remote(remote_idx):
 	return pack_ptr(RemoteObj(remote_idx)),
@@ -133,10 +332,105 @@ def cmd_call(size):
 def cmd_starcall(_):
 	return pack_ptr(read_ptr()(*read_ptr(), **read_ptr())),
 
+def cmd_update(idx):
+	obj = ptrs[idx]
+	get_fn, set_fn, slot, inplace_op, rhs = (read_ptr() for _ in range(5))
+	value = inplace_op(get_fn(obj, slot), rhs)
+	set_fn(obj, slot, value)
+	return pack_ptr(value),
+
+@functools.lru_cache(maxsize=256)
+def compile_snippet(code, arg_names):
+	# the code becomes the body of a function of the arguments, returning the value of a single expression
+	body = ast.parse(textwrap.dedent(code), '<snippet>').body
+	if len(body) == 1 and isinstance(body[0], ast.Expr):
+		body = [ast.Return(body[0].value)]
+	arguments = ast.arguments(posonlyargs=[], args=[ast.arg(name) for name in arg_names], kwonlyargs=[], kw_defaults=[], defaults=[])
+	function = ast.FunctionDef('snippet', arguments, body or [ast.Pass()], decorator_list=[])
+	if 'type_params' in ast.FunctionDef._fields:
+		function.type_params = []
+	module = ast.fix_missing_locations(ast.Module([function], type_ignores=[]))
+	namespace = {'__name__': '<snippet>'}
+	exec(compile(module, '<snippet>', 'exec'), namespace)
+	return namespace['snippet']
+
+def run_snippet(code, arg_names, arg_values):
+	return compile_snippet(code, tuple(arg_names))(*arg_values)
+
+def cmd_snippet(_):
+	code, *args = read_values()
+	return pack_ptr(run_snippet(code, args[::2], args[1::2])),
+
+def cmd_init_script(_):
+	# steps of (kind, name, ...), each result stored under its name and visible to the following snippets
+	values = iter(read_values())
+	results = {}
+	for kind in values:
+		name = next(values)
+		if kind == 'global':
+			results[name] = get_global(next(values))
+		elif kind == 'snippet':
+			code = next(values)
+			args = dict(results)
+			for _ in range(next(values)):
+				arg_name = next(values)
+				args[arg_name] = next(values)
+			results[name] = run_snippet(code, args.keys(), args.values())
+		elif kind == 'call':
+			fn = get_global(next(values))
+			results[name] = fn(*[next(values) for _ in range(next(values))])
+		else:
+			raise ValueError('Unknown init script step ' + kind)
+	if 'snaketongs_init' not in sys.modules:
+		sys.modules['snaketongs_init'] = types.ModuleType('snaketongs_init')
+	vars(sys.modules['snaketongs_init']).update(results)
+	return pack_ptr(results),
+
 def cmd_lambda(remote_obj):
 	remote_obj = ptrs[remote_obj]
 	return pack_ptr(lambda *args: call_lambda(remote_obj, args)),
 
+class CppReader(io.RawIOBase):
+	# see process::make_reader, fill is a c++ function writing into the view with cmd_fill
+	def __init__(self, fill):
+		self.fill = fill
+	def readable(self):
+		return True
+	def readinto(self, buffer):
+		return self.fill(memoryview(buffer).cast('B'))
+
+class CppWriter(io.RawIOBase):
+	# see process::make_writer
+	def __init__(self, drain):
+		self.drain = drain
+	def writable(self):
+		return True
+	def write(self, buffer):
+		view = memoryview(buffer).cast('B')
+		self.drain(view)
+		return len(view)
+
+class CppIterable:
+	# see process::make_iterable, begin returns a c++ function returning the next chunk as a list, empty at the end
+	def __init__(self, begin):
+		self.begin = begin
+	def __iter__(self):
+		next_chunk = self.begin()
+		while chunk := next_chunk():
+			yield from chunk
+
+def cmd_fill(idx):
+	size = read_int()
+	read_into(ptrs[idx][:size])
+	return pack_ptr(size),
+
+def cmd_with_enter(idx):
+	manager = ptrs[idx]
+	manager_type = type(manager)
+	enter_fn = manager_type.__enter__
+	exit_fn = manager_type.__exit__
+	return pack_ptr(enter_fn(manager)), pack_ptr((exit_fn, manager)),
+
 def cmd_dup(idx):
 	return pack_ptr(ptrs[idx]),
 
@@ -154,24 +448,173 @@ def cmd_get_bytes(idx):
 		return pack_int(len(obj)), obj,
 	raise TypeError('Cannot get bytes from:', obj)
 
+def cmd_get_ndarray(idx):
+	view = array_view(ptrs[idx], chr(read_int()))
+	return pack_int(view.ndim), *map(pack_int, view.shape), array_data(view),
+
+def cmd_get_columns(idx):
+	# e.g. from a dict of arrays, pandas.DataFrame or pyarrow.Table
+	table = ptrs[idx]
+	values = read_values()
+	response = [pack_int(len(values) // 2)]
+	for name, fmt in zip(values[::2], values[1::2]):
+		view = array_view(table[name], chr(fmt))
+		if view.ndim != 1:
+			raise ValueError('Column ' + name + ' is not one-dimensional')
+		response += pack_int(len(view)), array_data(view)
+	return tuple(response)
+
+def cmd_get_str_list(idx):
+	strings = list(ptrs[idx])
+	joined = ''.join(strings)
+	if joined.isascii():
+		data = joined.encode()
+	else:
+		strings = [string.encode() for string in strings]
+		data = b''.join(strings)
+	ends = itertools.accumulate(map(len, strings))
+	return pack_int(len(strings)), pack_int(len(data)), struct.pack(str(len(strings)) + 'N', *ends), data,
+
+def cmd_pickle(idx):
+	# protocol 5 with out-of-band buffers, which are written as they are instead of being copied into the pickle
+	import pickle
+	buffers = []
+	data = pickle.dumps(ptrs[idx], protocol=5, buffer_callback=buffers.append)
+	response = [pack_int(len(data)), data, pack_int(len(buffers))]
+	for buffer in buffers:
+		view = buffer.raw()
+		response += pack_int(view.nbytes), view
+	return tuple(response)
+
+def array_view(obj, fmt):
+	try:
+		view = memoryview(obj)
+	except TypeError:
+		view = None
+	if view is None or not same_item_type(view.format, fmt):
+		numpy = import_numpy()
+		if numpy is None:
+			raise TypeError('Cannot get array of ' + fmt + ' from:', obj)
+		view = memoryview(numpy.ascontiguousarray(obj, dtype=fmt))
+	return view
+
+def array_data(view):
+	return view.cast('B') if view.c_contiguous else view.tobytes()
+
+def import_numpy():
+	# arrays are numpy arrays if it is installed, multi-dimensional memoryviews otherwise
+	try:
+		import numpy
+		return numpy
+	except ImportError:
+		return None
+
+item_kinds = {**dict.fromkeys('bhilqn', 'int'), **dict.fromkeys('BHILQN', 'uint'), **dict.fromkeys('efd', 'float')}
+
+def same_item_type(view_format, fmt):
+	# native and little-endian standard formats are accepted (the interpreter runs on the same machine)
+	item_format = view_format
+	if len(view_format) == 2 and view_format[0] in '@=<':
+		if view_format[0] == '<' and sys.byteorder != 'little':
+			return False
+		item_format = view_format[1:]
+	return item_kinds.get(item_format) == item_kinds[fmt] and struct.calcsize(view_format) == struct.calcsize(fmt)
+
+def cmd_get_hash(idx):
+	obj = ptrs[idx]
+	return pack_int(hash(obj)), pack_int(1 if is_immutable(obj) else 0),
+
+def cmd_get_len(idx):
+	return pack_int(len(ptrs[idx])),
+
+def cmd_with_exit(idx):
+	exit_fn, manager = ptrs[idx]
+	exc = read_ptr()
+	if exc is None:
+		suppress = exit_fn(manager, None, None, None)
+	else:
+		suppress = exit_fn(manager, type(exc), exc, exc.__traceback__)
+	return pack_int(1 if suppress else 0),
+
+def cmd_set_items(idx):
+	obj = ptrs[idx]
+	values = read_values()
+	for key, value in zip(values[::2], values[1::2]):
+		obj[key] = value
+	return pack_int(0),
+
+def cmd_get_attrs(idx):
+	obj = ptrs[idx]
+	values = [getattr(obj, name) for name in read_values()]
+	return (pack_int(len(values)), *map(pack_ptr, values))
+
+def cmd_set_attrs(idx):
+	obj = ptrs[idx]
+	values = read_values()
+	for name, value in zip(values[::2], values[1::2]):
+		setattr(obj, name, value)
+	return pack_int(0),
+
 def cmd_del_ptr(idx):
 	del_ptr(idx)
 	return NoResponse
 
+gc_pause_depth = 0
+gc_enabled_before_pause = False
+
+def cmd_gc_control(action):
+	# 1 = pause, 0 = resume, -1 = resume and collect (nested pauses only resume at the outermost level)
+	global gc_pause_depth, gc_enabled_before_pause
+	if action > 0:
+		if not gc_pause_depth:
+			gc_enabled_before_pause = gc.isenabled()
+			gc.disable()
+		gc_pause_depth += 1
+	else:
+		gc_pause_depth -= 1
+		if not gc_pause_depth and gc_enabled_before_pause:
+			gc.enable()
+		if not gc_pause_depth and action < 0:
+			gc.collect()
+	return NoResponse
+
 cmds = {
 	ord('I'): cmd_make_int,
 	ord('B'): cmd_make_bytes,
 	ord('S'): cmd_make_str,
 	ord('T'): cmd_make_tuple,
+	ord('M'): cmd_make_dict,
 	ord('G'): cmd_make_global,
 	ord('R'): cmd_make_remote,
 	ord('C'): cmd_call,
 	ord('X'): cmd_starcall,
+	ord('U'): cmd_update,
+	ord('E'): cmd_snippet,
+	ord('N'): cmd_init_script,
 	ord('L'): cmd_lambda,
+	ord('W'): cmd_with_enter,
 	ord('D'): cmd_dup,
 	ord('i'): cmd_get_int,
 	ord('b'): cmd_get_bytes,
+	ord('Y'): cmd_make_ndarray,
+	ord('y'): cmd_get_ndarray,
+	ord('K'): cmd_make_columns,
+	ord('k'): cmd_get_columns,
+	ord('Q'): cmd_unpickle,
+	ord('q'): cmd_pickle,
+	ord('J'): cmd_make_str_list,
+	ord('j'): cmd_get_str_list,
+	ord('F'): cmd_fill,
+	ord('V'): cmd_make_list,
+	ord('H'): cmd_map_shared,
+	ord('h'): cmd_get_hash,
+	ord('l'): cmd_get_len,
+	ord('w'): cmd_with_exit,
+	ord('P'): cmd_set_items,
+	ord('a'): cmd_get_attrs,
+	ord('A'): cmd_set_attrs,
 	ord('~'): cmd_del_ptr,
+	ord('g'): cmd_gc_control,
 }
 
 CMD_RET = ord('r')
@@ -205,6 +648,11 @@ def read(n):
 		os._exit(125)
 	return b
 
+def read_into(buffer):
+	if cpp_to_py.readinto(buffer) != len(buffer):
+		import os
+		os._exit(125)  # short read, see above
+
 def read_int():
 	return int.from_bytes(read(int_size), byteorder='little', signed=True)
 
@@ -214,6 +662,45 @@ def read_ptr():
 def read_str(size):
 	return str(read(size), 'utf8')
 
+immutable_types = {type(None), bool, int, float, complex, str, bytes}
+
+def is_immutable(obj):
+	obj_type = type(obj)
+	if obj_type in immutable_types:
+		return True
+	if obj_type is tuple or obj_type is frozenset:
+		return all(map(is_immutable, obj))
+	return False
+
+# values sent inline, each prefixed by a tag, see process::send_value
+
+class ValuesAborted(Exception):
+	pass
+
+def abort_values():
+	raise ValuesAborted('C++ code threw while sending values')
+
+value_readers = {
+	ord('o'): read_ptr,
+	ord('i'): read_int,
+	ord('f'): lambda: struct.unpack('d', read(8))[0],
+	ord('s'): lambda: read_str(read_int()),
+	ord('b'): lambda: read(read_int()),
+	ord('T'): lambda: True,
+	ord('F'): lambda: False,
+	ord('!'): abort_values,
+}
+
+VALUES_END = ord('.')
+
+def read_values():
+	values = []
+	while True:
+		tag, = read(1)
+		if tag == VALUES_END:
+			return values
+		values.append(value_readers[tag]())
+
 #################
 #               #
 #   main loop   #
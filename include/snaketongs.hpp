@@ -2,20 +2,33 @@
 #define SNAKETONGS_HPP_
 
 #include <algorithm>
+#include <array>
 #include <concepts>
+#include <condition_variable>
 #include <cstdio>
 #include <exception>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
 #include <span>
 #include <stdexcept>
+#include <streambuf>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
 // snaketongs_impl*
 #include "snaketongs_subproc.h"
 
@@ -83,6 +96,19 @@ concept ostream_like = requires(T &&stream, std::string s) {
 	FWD(stream) << std::move(s);
 };
 
+// std::istream and std::ostream, for unformatted binary input/output
+
+template<typename T>
+concept istream_like = requires(T &stream, char *s, std::ptrdiff_t n) {
+	stream.read(s, n);
+	{stream.gcount()} -> std::convertible_to<std::size_t>;
+};
+
+template<typename T>
+concept binary_ostream_like = requires(T &stream, const char *s, std::ptrdiff_t n) {
+	stream.write(s, n);
+};
+
 
 ///////////////////////////////////////////////
 //                                           //
@@ -117,6 +143,14 @@ using process = process_t<object, cpp_wrapped_py_exc>;
 
 struct python_iterator;
 
+struct object_guard;
+
+class gc_pause;
+
+class pending_call;
+
+void exchange(std::span<pending_call> calls);
+
 // utilities
 
 template<typename = std::size_t>
@@ -138,6 +172,31 @@ struct io_error : std::runtime_error {
 	using std::runtime_error::runtime_error;
 };
 
+// the subprocess was killed for exceeding its CPU time limit or the memory limit of its cgroup
+struct resource_limit_error : io_error {
+	resource_limit_error() : io_error("Subprocess exceeded its resource limits") {}
+};
+
+// path of a unix socket of a running snaketongs server (`python3 entry.py --serve PATH`)
+struct server_socket {
+	const char *path;
+	constexpr explicit server_socket(const char *path) noexcept : path(path) {}
+};
+
+// options for starting the interpreter subprocess (a plain `const char *` constructor argument is the same as `.python`)
+struct start_options {
+	const char *python = nullptr; // interpreter command, see README
+	std::vector<int> cpus = {}; // CPUs the interpreter may run on, empty for any
+	bool same_core_complex = false; // restrict the interpreter to CPUs sharing the last level cache with the calling thread
+	bool pin_caller = false; // pin the calling thread to the same CPUs as the interpreter
+	bool gc_disabled = false; // disable the cyclic garbage collector of the interpreter
+	std::optional<std::array<int, 3>> gc_thresholds = {}; // gc.set_threshold() arguments
+	std::size_t max_memory = 0; // RLIMIT_AS in bytes (allocations fail with a MemoryError), 0 for no limit
+	unsigned max_cpu_seconds = 0; // RLIMIT_CPU (the interpreter is killed), 0 for no limit
+	const char *cgroup = nullptr; // cgroup v2 path, absolute or relative to /sys/fs/cgroup
+	const char *import_cache = nullptr; // directory to persist module locations in, see README
+};
+
 struct py_exc_during_init : io_error {
 	py_exc_during_init() : io_error("A Python exception was thrown during snaketongs::process initialization") {}
 };
@@ -193,6 +252,114 @@ concept bytes_like = !std::same_as<std::remove_cvref_t<T>, object> && requires(T
 	f(FWD(t));
 };
 
+// item of an n-dimensional array, and its format character in python's struct module
+
+template<typename T>
+concept array_item = std::is_arithmetic_v<T> && !std::same_as<T, bool> && !std::same_as<T, long double>;
+
+template<array_item T>
+constexpr char array_item_format() {
+	static_assert(sizeof(float) == 4 && sizeof(double) == 8);
+	constexpr std::size_t size_idx = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+	if constexpr(std::floating_point<T>)
+		return std::same_as<T, float> ? 'f' : 'd';
+	else if constexpr(std::is_signed_v<T>)
+		return "bhiq"[size_idx];
+	else
+		return "BHIQ"[size_idx];
+}
+
+// std::mdspan, or any type with the same interface (strides are in items)
+
+template<typename M>
+concept mdspan_like = array_item<std::remove_const_t<typename M::element_type>> && requires(const M &m, std::size_t r) {
+	{m.rank()} -> std::convertible_to<std::size_t>;
+	{m.extent(r)} -> std::convertible_to<std::size_t>;
+	{m.stride(r)} -> std::convertible_to<std::size_t>;
+	{m.data_handle()} -> std::convertible_to<const typename M::element_type *>;
+};
+
+// n-dimensional array copied from python, with the items in C order
+template<array_item T>
+struct ndarray {
+	std::vector<std::size_t> shape;
+	std::vector<T> data;
+
+#if __cpp_lib_mdspan >= 202207L
+	template<std::size_t Rank>
+	std::mdspan<T, std::dextents<std::size_t, Rank>> view() {
+		if(shape.size() != Rank)
+			throw std::invalid_argument("Array rank mismatch");
+		std::array<std::size_t, Rank> extents;
+		std::ranges::copy(shape, extents.begin());
+		return {data.data(), extents};
+	}
+#endif
+};
+
+// list of strings copied from python: the concatenated UTF-8 data and the end offset of each string
+struct string_list {
+	std::string data;
+	std::vector<std::size_t> ends;
+
+	std::size_t size() const {
+		return ends.size();
+	}
+	std::string_view operator[](std::size_t i) const {
+		std::size_t start = i ? ends[i - 1] : 0;
+		return std::string_view(data).substr(start, ends[i] - start);
+	}
+	// range of std::string_view
+	auto strings() const {
+		return std::views::iota(std::size_t(0), size()) | std::views::transform([this](std::size_t i) { return (*this)[i]; });
+	}
+};
+
+// result of pickle.dumps with protocol 5, with the out-of-band buffers (e.g. numpy arrays' data) kept separate
+struct pickled {
+	std::vector<std::byte> data;
+	std::vector<std::vector<std::byte>> buffers;
+};
+
+// named column of a table sent to python, refers to the items of a contiguous range
+struct column {
+	std::string_view name;
+	char format;
+	std::size_t size, item_size;
+	const void *items;
+
+	template<std::ranges::contiguous_range R, array_item T = std::ranges::range_value_t<R>>
+	column(std::string_view name, const R &items)
+		: name(name), format(array_item_format<T>()), size(std::ranges::size(items)), item_size(sizeof(T)), items(std::ranges::data(items)) {}
+};
+
+template<array_item T>
+class shared_buffer;
+
+// value that can be sent to python inline within a command, without creating a temporary python object first
+
+template<typename T>
+concept inline_value = std::is_convertible_v<T, const object &> || std::is_arithmetic_v<std::remove_cvref_t<T>>
+	|| std::is_convertible_v<T, std::string_view> || bytes_like<T>;
+
+// key-value pair (e.g. std::pair or std::tuple) of pythonizable values
+
+template<typename T>
+concept pythonizable_pair = requires(T &&t) {
+	requires std::tuple_size<std::remove_cvref_t<T>>::value == 2;
+	{std::get<0>(FWD(t))} -> pythonizable;
+	{std::get<1>(FWD(t))} -> pythonizable;
+};
+
+template<typename T>
+concept inline_pair = pythonizable_pair<T> && requires(T &&t) {
+	{std::get<0>(FWD(t))} -> inline_value;
+	{std::get<1>(FWD(t))} -> inline_value;
+};
+
+template<typename R>
+concept pythonizable_pair_range = std::ranges::input_range<R> && pythonizable_pair<std::ranges::range_reference_t<R>>;
+
 // types that can possibly be used to store strings - string_view on c++ side, object on python side
 
 template<typename T>
@@ -263,6 +430,65 @@ concept special_arg = std::same_as<T, star_object> || std::same_as<T, star_star_
 template<typename... Ts>
 static constexpr bool none_is_special = !(... || special_arg<std::remove_cvref_t<Ts>>);
 
+// inline value that does not refer to any particular process
+template<typename T>
+concept recordable_value = inline_value<T> && !std::is_convertible_v<T, const object &>;
+
+
+/////////////////////
+//                 //
+//   init script   //
+//                 //
+/////////////////////
+
+// a recorded initialization sequence, replayed on a (fresh) process in a single command by proc.run_init_script(script);
+// each step stores its result under a name
+class init_script {
+	using value = std::variant<bool, int_t, double, std::string, std::vector<std::byte>>;
+	std::vector<value> values;
+
+	void add(recordable_value auto &&v) {
+		using T = std::remove_cvref_t<decltype(v)>;
+		if constexpr(std::same_as<T, bool>)
+			values.emplace_back(std::in_place_type<bool>, v);
+		else if constexpr(std::integral<T>)
+			values.emplace_back(std::in_place_type<int_t>, v);
+		else if constexpr(std::floating_point<T>)
+			values.emplace_back(std::in_place_type<double>, v);
+		else if constexpr(std::is_convertible_v<decltype(v), std::string_view>)
+			values.emplace_back(std::in_place_type<std::string>, std::string_view(FWD(v)));
+		else {
+			std::span<const std::byte> span = FWD(v);
+			values.emplace_back(std::in_place_type<std::vector<std::byte>>, span.begin(), span.end());
+		}
+	}
+
+	template<typename, typename>
+	friend class process_t;
+
+public:
+	// name = proc[qualname]
+	init_script &global(std::string_view name, std::string_view qualname) {
+		add("global"), add(name), add(qualname);
+		return *this;
+	}
+
+	// name = proc.run_snippet(code, args...), with the results of the previous steps also available to the code
+	template<recordable_value... V>
+	init_script &snippet(std::string_view name, std::string_view code, kw_arg<std::string_view, V> &&... args) {
+		add("snippet"), add(name), add(code), add(sizeof...(args));
+		(..., (add(args.key), add(FWD(args.value))));
+		return *this;
+	}
+
+	// name = proc[qualname](args...), e.g. a constructor call
+	init_script &call(std::string_view name, std::string_view qualname, recordable_value auto &&... args) {
+		add("call"), add(name), add(qualname), add(sizeof...(args));
+		(..., add(FWD(args)));
+		return *this;
+	}
+};
+
 
 /////////////////
 //             //
@@ -274,26 +500,56 @@ class process_base {
 	struct snaketongs_impl *impl;
 
 public:
-	explicit process_base(const char *python) {
-		impl = snaketongs_impl_start(python, int_size);
+	explicit process_base(const start_options &options) {
+		snaketongs_impl_options c_options = {
+			.python = options.python,
+			.cpus = options.cpus.empty() ? nullptr : options.cpus.data(),
+			.num_cpus = options.cpus.size(),
+			.near_caller = options.same_core_complex,
+			.pin_caller = options.pin_caller,
+			.gc_disable = options.gc_disabled,
+			.gc_thresholds = options.gc_thresholds ? options.gc_thresholds->data() : nullptr,
+			.max_memory = options.max_memory,
+			.max_cpu_seconds = options.max_cpu_seconds,
+			.cgroup = options.cgroup,
+			.import_cache = options.import_cache,
+		};
+		impl = snaketongs_impl_start_with(&c_options, int_size);
 		if(!impl)
 			throw io_error("Cannot start subprocess");
 	}
+	explicit process_base(const char *python) : process_base(start_options{.python = python}) {}
 	process_base() : process_base(nullptr) {}
+	explicit process_base(server_socket server) {
+		impl = snaketongs_impl_connect(server.path, int_size);
+		if(!impl)
+			throw io_error("Cannot connect to server");
+	}
 	process_base(const process_base &) = delete;
 	void operator=(const process_base &) = delete;
 
+	[[noreturn]] void fail(const char *msg) {
+		if(snaketongs_impl_limit_exceeded(impl))
+			throw resource_limit_error();
+		int status, signal;
+		if(!snaketongs_impl_exit_status(impl, &status, &signal))
+			throw io_error(msg);
+		if(signal)
+			throw io_error(msg + (" (killed by signal " + std::to_string(signal) + ")"));
+		throw io_error(msg + (" (exited with status " + std::to_string(status) + ")"));
+	}
+
 	void send(const void *src, size_t size) {
 		if(!snaketongs_impl_send(impl, src, size))
-			throw io_error("Cannot send data to subprocess");
+			fail("Cannot send data to subprocess");
 	}
 	void flush() {
 		if(!snaketongs_impl_flush(impl))
-			throw io_error("Cannot send data to subprocess");
+			fail("Cannot send data to subprocess");
 	}
 	void recv(void *dest, size_t size) {
 		if(!snaketongs_impl_recv(impl, dest, size))
-			throw io_error("Cannot receive data from subprocess");
+			fail("Cannot receive data from subprocess");
 	}
 	void quit() {
 		auto i = impl;
@@ -306,6 +562,29 @@ public:
 		return !impl;
 	}
 
+	// whether the interpreter is known to have ended (false does not guarantee it is still running)
+	bool exited() {
+		int status, signal;
+		return !terminated() && snaketongs_impl_exit_status(impl, &status, &signal);
+	}
+
+	// resident memory of the interpreter in bytes, or nullopt if unknown
+	std::optional<std::size_t> resident_memory() {
+		std::size_t rss = terminated() ? 0 : snaketongs_impl_rss(impl);
+		return rss ? std::optional(rss) : std::nullopt;
+	}
+
+	// flushes all the processes and waits for a response from each of them at once;
+	// errors are not reported here but by the next recv() of the affected process
+	static void exchange(std::span<process_base *const> procs) {
+		std::vector<struct snaketongs_impl *> impls;
+		impls.reserve(procs.size());
+		for(process_base *p : procs)
+			if(!p->terminated())
+				impls.push_back(p->impl);
+		snaketongs_impl_exchange_many(impls.data(), impls.size());
+	}
+
 	~process_base() {
 		// this->quit() may or may not have been called
 		if(!terminated())
@@ -341,6 +620,18 @@ class process_t : process_base {
 	free_list_entry py_to_cpp_ptrs_free_list;
 	bool initialized = false;
 
+	// values of immutable python objects by remote_idx, forgotten when the index is released (python reuses indices)
+	struct immutable_cache_entry {
+		std::optional<int_t> hash; // always cached (when python reports the object as immutable)
+		std::optional<int_t> integer; // conversions only cached when enabled by cache_conversions()
+		std::optional<double> floating;
+		std::optional<std::string> bytes;
+	};
+	std::unordered_map<int_t, immutable_cache_entry> immutable_cache;
+	bool conversions_cached = false;
+
+	std::size_t calls_sent = 0;
+
 	// (more data members at the end of the class)
 
 	// python to c++
@@ -431,11 +722,34 @@ class process_t : process_base {
 		make_remote = 'R',
 		call        = 'C',
 		starcall    = 'X',
+		make_dict   = 'M',
+		update      = 'U',
+		snippet     = 'E',
+		init_script = 'N',
 		lambda      = 'L',
+		with_enter  = 'W',
 		dup         = 'D',
 		get_int     = 'i',
 		get_bytes   = 'b',
+		make_ndarray = 'Y',
+		get_ndarray = 'y',
+		make_columns = 'K',
+		get_columns = 'k',
+		unpickle    = 'Q',
+		pickle      = 'q',
+		make_str_list = 'J',
+		get_str_list = 'j',
+		fill        = 'F',
+		make_list   = 'V',
+		map_shared  = 'H',
+		get_hash    = 'h',
+		get_len     = 'l',
+		with_exit   = 'w',
+		set_items   = 'P',
+		get_attrs   = 'a',
+		set_attrs   = 'A',
 		del_ptr     = '~',
+		gc_control  = 'g',
 		ret         = 'r',
 		exc         = 'e',
 	};
@@ -460,6 +774,101 @@ class process_t : process_base {
 		send_cmd(c, obj.remote_idx);
 	}
 
+	// values sent inline within a command, see read_values in entry.py
+
+	enum class value_tag : unsigned char {
+		ptr    = 'o',
+		int_   = 'i',
+		float_ = 'f',
+		str    = 's',
+		bytes  = 'b',
+		true_  = 'T',
+		false_ = 'F',
+		end    = '.',
+		abort  = '!',
+	};
+
+	void send_tag(value_tag tag) {
+		send(&tag, 1);
+	}
+
+	void send_value(inline_value auto &&value) {
+		using T = std::remove_cvref_t<decltype(value)>;
+		if constexpr(std::is_convertible_v<decltype(value), const object &>) {
+			raw_object obj = into_object(FWD(value)).raw; // may throw, so before the tag
+			send_tag(value_tag::ptr);
+			send_object(obj);
+		} else if constexpr(std::same_as<T, bool>) {
+			send_tag(value ? value_tag::true_ : value_tag::false_);
+		} else if constexpr(std::integral<T>) {
+			send_tag(value_tag::int_);
+			send_int(value);
+		} else if constexpr(std::floating_point<T>) {
+			static_assert(std::numeric_limits<double>::is_iec559 && sizeof(double) == 8);
+			double d = value;
+			send_tag(value_tag::float_);
+			send(&d, sizeof d);
+		} else if constexpr(std::is_convertible_v<decltype(value), std::string_view>) {
+			std::string_view str = FWD(value);
+			send_tag(value_tag::str);
+			send_int(str.size());
+			send(str.data(), str.size());
+		} else {
+			std::span<const std::byte> span = FWD(value);
+			send_tag(value_tag::bytes);
+			send_int(span.size());
+			send(span.data(), span.size());
+		}
+	}
+
+	// sends a command followed by values terminated by the end tag;
+	// if send_all throws, python is told to abort the command and the exception is propagated
+	int_t cmd_values(cmd c, int_t arg, auto &&send_all) {
+		send_cmd(c, arg);
+		try {
+			send_all();
+		} catch(...) {
+			try {
+				send_tag(value_tag::abort);
+				wait_for_ret();
+			} catch(...) {}
+			throw;
+		}
+		send_tag(value_tag::end);
+		return wait_for_ret();
+	}
+
+	// for values not encodable inline, the python object is created before the command is sent
+	decltype(auto) inline_or_object(pythonizable auto &&value) {
+		if constexpr(inline_value<decltype(value)>)
+			return FWD(value);
+		else
+			return object(into_object(FWD(value)).dup());
+	}
+
+	// the range must not call into python while being iterated
+	int_t cmd_pairs(cmd c, int_t arg, pythonizable_pair_range auto &&pairs) {
+		if constexpr(inline_pair<std::ranges::range_reference_t<decltype(pairs)>>) {
+			return cmd_values(c, arg, [&] {
+				for(auto &&[key, value] : pairs) {
+					send_value(key);
+					send_value(value);
+				}
+			});
+		} else {
+			// convert to objects first, so that no other command is sent in the middle of this one
+			std::vector<object> objects;
+			for(auto &&[key, value] : pairs) {
+				objects.push_back(into_object(key).dup());
+				objects.push_back(into_object(value).dup());
+			}
+			return cmd_values(c, arg, [&] {
+				for(const object &obj : objects)
+					send_value(obj);
+			});
+		}
+	}
+
 	// c++ to python - commands
 
 	object cmd_make_int(int_t value) {
@@ -473,6 +882,45 @@ class process_t : process_base {
 		return wait_for_object();
 	}
 
+	template<array_item T>
+	object cmd_make_ndarray(const T *data, std::span<const std::size_t> shape, std::span<const std::size_t> strides) {
+		send_cmd(cmd::make_ndarray, shape.size());
+		char format = array_item_format<T>();
+		send(&format, 1);
+		for(std::size_t extent : shape)
+			send_int(extent);
+		send_items(data, shape, strides);
+		return wait_for_object();
+	}
+
+	object cmd_make_columns(std::span<const column> columns) {
+		send_cmd(cmd::make_columns, columns.size());
+		for(const column &c : columns) {
+			send_int(c.name.size());
+			send(c.name.data(), c.name.size());
+			send(&c.format, 1);
+			send_int(c.size);
+			send(c.items, c.size * c.item_size);
+		}
+		return wait_for_object();
+	}
+
+	// sends the items in C order, contiguous parts at once (empty strides mean C order)
+	template<typename T>
+	void send_items(const T *data, std::span<const std::size_t> shape, std::span<const std::size_t> strides) {
+		std::size_t size = 1;
+		bool contiguous = true;
+		for(std::size_t dim = shape.size(); dim-- > 0; size *= shape[dim])
+			if(!strides.empty() && shape[dim] != 1 && strides[dim] != size)
+				contiguous = false;
+		if(contiguous) {
+			send(data, size * sizeof(T));
+			return;
+		}
+		for(std::size_t i = 0; i < shape[0]; i++)
+			send_items(data + i * strides[0], shape.subspan(1), strides.subspan(1));
+	}
+
 	object cmd_make_str(size_t size, const char *data) {
 		send_cmd(cmd::make_str, size);
 		send(data, size);
@@ -507,19 +955,39 @@ class process_t : process_base {
 		return wait_for_object();
 	}
 
-	object cmd_call(raw_object fn, std::initializer_list<raw_object> args) {
+	// the send_ variants leave waiting for the response to pending_call
+	void send_call(raw_object fn, std::initializer_list<raw_object> args) {
+		calls_sent++;
 		send_cmd(cmd::call, args.size());
 		send_object(fn);
 		for(raw_object arg : args)
 			send_object(arg);
+	}
+	object cmd_call(raw_object fn, std::initializer_list<raw_object> args) {
+		send_call(fn, args);
 		return wait_for_object();
 	}
 
-	object cmd_starcall(raw_object fn, raw_object args, raw_object kwargs) {
+	void send_starcall(raw_object fn, raw_object args, raw_object kwargs) {
+		calls_sent++;
 		send_cmd(cmd::starcall, -1);
 		send_object(fn);
 		send_object(args);
 		send_object(kwargs);
+	}
+	object cmd_starcall(raw_object fn, raw_object args, raw_object kwargs) {
+		send_starcall(fn, args, kwargs);
+		return wait_for_object();
+	}
+
+	// obj[slot] = inplace_op(obj[slot], rhs) - with get_fn and set_fn selecting items or attributes
+	object cmd_update(const object &obj, const object &get_fn, const object &set_fn, const object &slot, const object &inplace_op, const object &rhs) {
+		send_cmd(cmd::update, obj.raw);
+		send_object(get_fn.raw);
+		send_object(set_fn.raw);
+		send_object(slot.raw);
+		send_object(inplace_op.raw);
+		send_object(rhs.raw);
 		return wait_for_object();
 	}
 
@@ -528,29 +996,258 @@ class process_t : process_base {
 		return wait_for_object();
 	}
 
+	// returns the value of __enter__ and a handle to be passed to cmd_with_exit
+	std::pair<object, object> cmd_with_enter(const object &manager) {
+		send_cmd(cmd::with_enter, manager.raw);
+		object value = wait_for_object();
+		return {std::move(value), cook({recv_int()})};
+	}
+
 	object cmd_dup(raw_object obj) {
 		send_cmd(cmd::dup, obj);
 		return wait_for_object();
 	}
 
+	object cmd_make_dict(pythonizable_pair_range auto &&pairs) {
+		return cook({cmd_pairs(cmd::make_dict, 0, FWD(pairs))});
+	}
+
+	void cmd_set_items(raw_object obj, pythonizable_pair_range auto &&pairs) {
+		cmd_pairs(cmd::set_items, obj.remote_idx, FWD(pairs));
+	}
+
+	template<typename... V>
+	object cmd_snippet(std::string_view code, kw_arg<std::string_view, V> &&... args) {
+		return [&](auto &&... values) {
+			return cook({cmd_values(cmd::snippet, 0, [&] {
+				send_value(code);
+				(..., (send_value(args.key), send_value(values)));
+			})});
+		}(inline_or_object(FWD(args.value))...);
+	}
+
+	object cmd_init_script(const init_script &script) {
+		return cook({cmd_values(cmd::init_script, 0, [&] {
+			for(const auto &value : script.values)
+				std::visit([&](const auto &v) { send_value(v); }, value);
+		})});
+	}
+
+	std::vector<object> cmd_get_attrs(raw_object obj, std::span<const std::string_view> names) {
+		int_t num_values = cmd_values(cmd::get_attrs, obj.remote_idx, [&] {
+			for(std::string_view name : names)
+				send_value(name);
+		});
+		std::vector<object> values;
+		values.reserve(num_values);
+		for(int_t i = 0; i < num_values; i++)
+			values.push_back(cook({recv_int()}));
+		return values;
+	}
+
+	void cmd_set_attrs(raw_object obj, pythonizable_pair_range auto &&pairs) {
+		cmd_pairs(cmd::set_attrs, obj.remote_idx, FWD(pairs));
+	}
+
 	int_t cmd_get_int(raw_object obj) {
-		send_cmd(cmd::get_int, obj);
-		return wait_for_ret();
+		return cached_conversion(obj, &immutable_cache_entry::integer, [&] {
+			send_cmd(cmd::get_int, obj);
+			return wait_for_ret();
+		});
 	}
 
 	template<typename Container, auto... Exprs>
 	Container cmd_get_bytes(raw_object obj) {
-		send_cmd(cmd::get_bytes, obj);
-		int_t size = wait_for_ret();
-		auto result = Container(size, Exprs...);
-		recv(result.data(), size);
+		auto fetch = [&]<typename Result> {
+			send_cmd(cmd::get_bytes, obj);
+			int_t size = wait_for_ret();
+			auto result = Result(size, Exprs...);
+			recv(result.data(), size);
+			return result;
+		};
+		if(!conversions_cached)
+			return fetch.template operator()<Container>();
+		std::optional<std::string> &cached = immutable_cache[obj.remote_idx].bytes;
+		if(!cached)
+			cached = fetch.template operator()<std::string>();
+		return Container(cached->begin(), cached->end());
+	}
+
+	template<array_item T>
+	ndarray<T> cmd_get_ndarray(raw_object obj) {
+		send_cmd(cmd::get_ndarray, obj);
+		send_int(array_item_format<T>());
+		ndarray<T> result;
+		result.shape.resize(wait_for_ret());
+		std::size_t size = 1;
+		for(std::size_t &extent : result.shape)
+			size *= extent = recv_int();
+		result.data.resize(size);
+		recv(result.data.data(), size * sizeof(T));
+		return result;
+	}
+
+	object cmd_make_str_list(std::ranges::forward_range auto &&strings) {
+		std::vector<std::size_t> ends;
+		std::size_t size = 0;
+		// bound first, the range may yield temporary strings (e.g. a transform view)
+		for(auto &&item : strings) {
+			std::string_view str = item;
+			ends.push_back(size += str.size());
+		}
+		send_cmd(cmd::make_str_list, ends.size());
+		send_int(size);
+		send(ends.data(), ends.size() * sizeof(std::size_t));
+		for(auto &&item : strings) {
+			std::string_view str = item;
+			send(str.data(), str.size());
+		}
+		return wait_for_object();
+	}
+
+	string_list cmd_get_str_list(raw_object obj) {
+		send_cmd(cmd::get_str_list, obj);
+		string_list result;
+		result.ends.resize(wait_for_ret());
+		result.data.resize(recv_int());
+		recv(result.ends.data(), result.ends.size() * sizeof(std::size_t));
+		recv(result.data.data(), result.data.size());
+		return result;
+	}
+
+	// list of the next (up to) max_size items, advancing the iterator
+	template<std::input_iterator I, std::sentinel_for<I> S>
+	object cmd_make_list(I &it, const S &end, std::size_t max_size) {
+		using reference = std::iter_reference_t<I>;
+		if constexpr(inline_value<reference>) {
+			// taken before the message starts, advancing or dereferencing may call python itself (e.g. in a transform view);
+			// references into a multi-pass range stay valid, anything else is kept by value
+			constexpr bool by_address = std::is_lvalue_reference_v<reference> && std::forward_iterator<I>;
+			std::vector<std::conditional_t<by_address, std::remove_reference_t<reference> *, std::remove_cvref_t<reference>>> items;
+			for(std::size_t i = 0; i < max_size && it != end; i++, ++it) {
+				if constexpr(by_address)
+					items.push_back(std::addressof(*it));
+				else
+					items.push_back(*it);
+			}
+			return cook({cmd_values(cmd::make_list, 0, [&] {
+				for(auto &item : items) {
+					if constexpr(by_address)
+						send_value(*item);
+					else
+						send_value(item);
+				}
+			})});
+		} else {
+			// convert to objects first, so that no other command is sent in the middle of this one
+			std::vector<object> objects;
+			for(std::size_t i = 0; i < max_size && it != end; i++, ++it)
+				objects.push_back(into_object(*it).dup());
+			return cook({cmd_values(cmd::make_list, 0, [&] {
+				for(const object &obj : objects)
+					send_value(obj);
+			})});
+		}
+	}
+
+	object cmd_map_shared(std::string_view name, char format, std::size_t size) {
+		send_cmd(cmd::map_shared, size);
+		send_int(name.size());
+		send(name.data(), name.size());
+		send(&format, 1);
+		return wait_for_object();
+	}
+
+	// writes the data into a python buffer
+	object cmd_fill(raw_object buffer, const std::byte *data, std::size_t size) {
+		send_cmd(cmd::fill, buffer);
+		send_int(size);
+		send(data, size);
+		return wait_for_object();
+	}
+
+	object cmd_unpickle(const pickled &p) {
+		send_cmd(cmd::unpickle, p.buffers.size());
+		send_int(p.data.size());
+		send(p.data.data(), p.data.size());
+		for(const std::vector<std::byte> &buffer : p.buffers) {
+			send_int(buffer.size());
+			send(buffer.data(), buffer.size());
+		}
+		return wait_for_object();
+	}
+
+	pickled cmd_pickle(raw_object obj) {
+		send_cmd(cmd::pickle, obj);
+		pickled result;
+		result.data = recv_bytes(wait_for_ret());
+		result.buffers.resize(recv_int());
+		for(std::vector<std::byte> &buffer : result.buffers)
+			buffer = recv_bytes(recv_int());
 		return result;
 	}
 
+	std::vector<std::byte> recv_bytes(std::size_t size) {
+		std::vector<std::byte> bytes(size);
+		recv(bytes.data(), size);
+		return bytes;
+	}
+
+	template<array_item... T>
+	std::tuple<std::vector<T>...> cmd_get_columns(raw_object obj, std::span<const std::string_view, sizeof...(T)> names) {
+		cmd_values(cmd::get_columns, obj.remote_idx, [&] {
+			std::size_t i = 0;
+			(..., (send_value(names[i++]), send_value(int_t(array_item_format<T>()))));
+		});
+		return {recv_column<T>()...}; // braced initialization is evaluated in order
+	}
+
+	template<typename T>
+	std::vector<T> recv_column() {
+		std::vector<T> items(recv_int());
+		recv(items.data(), items.size() * sizeof(T));
+		return items;
+	}
+
+	// exc is None when leaving normally, returns whether the exception should be suppressed
+	bool cmd_with_exit(const object &exit_handle, const object &exc) {
+		send_cmd(cmd::with_exit, exit_handle.raw);
+		send_object(exc.raw);
+		return wait_for_ret();
+	}
+
+	int_t cmd_get_hash(raw_object obj) {
+		if(auto cached = immutable_cache.find(obj.remote_idx); cached != immutable_cache.end() && cached->second.hash)
+			return *cached->second.hash;
+		send_cmd(cmd::get_hash, obj);
+		int_t hash = wait_for_ret();
+		if(recv_int()) // immutable
+			immutable_cache[obj.remote_idx].hash = hash;
+		return hash;
+	}
+
+	int_t cmd_get_len(raw_object obj) {
+		send_cmd(cmd::get_len, obj);
+		return wait_for_ret();
+	}
+
 	void cmd_del_ptr(raw_object obj) {
+		if(!immutable_cache.empty())
+			immutable_cache.erase(obj.remote_idx);
 		send_cmd(cmd::del_ptr, obj);
 	}
 
+	// no response, so the pause is only sent along with the next command
+	void cmd_gc_pause() {
+		send_cmd(cmd::gc_control, 1);
+	}
+
+	// flushed right away, so that a collection runs while c++ continues
+	void cmd_gc_resume(bool collect) {
+		send_cmd(cmd::gc_control, collect ? -1 : 0);
+		flush();
+	}
+
 	void cmd_ret(const object &obj) {
 		send_cmd(cmd::ret, obj.raw);
 	}
@@ -562,6 +1259,30 @@ class process_t : process_base {
 		send_cmd(cmd::exc, obj.raw);
 	}
 
+	// float conversion (python floats have no exact decimal representation, so their hex representation is used)
+
+	double get_float(const object &obj) {
+		return cached_conversion(obj.raw, &immutable_cache_entry::floating, [&] {
+			double d;
+			if(std::sscanf(std::string(float_.call("hex", obj)).c_str(), "%la", &d) != 1)
+				throw io_error("float.hex() returned invalid string");
+			return d;
+		});
+	}
+
+	// conversions only succeed for immutable objects (int, str, bytes, float, and their subclasses),
+	// so once converted, the value is valid for as long as the remote index is
+
+	template<typename T>
+	T cached_conversion(raw_object obj, std::optional<T> immutable_cache_entry::*member, auto &&convert) {
+		if(!conversions_cached)
+			return convert();
+		std::optional<T> &cached = immutable_cache[obj.remote_idx].*member; // references survive rehashing
+		if(!cached)
+			cached = convert();
+		return *cached;
+	}
+
 	// raw_object to object
 
 	object cook(raw_object obj) {
@@ -583,6 +1304,10 @@ class process_t : process_base {
 	}
 
 	friend object;
+	friend object_guard;
+	friend gc_pause;
+	friend pending_call;
+	friend void exchange(std::span<pending_call> calls);
 	template<typename F, std::size_t MaxArity>
 	friend class functor_wrapper;
 
@@ -595,9 +1320,31 @@ public:
 		cmd_ret_from_main_loop();
 		quit();
 		py_to_cpp_ptrs.clear();
+		immutable_cache.clear();
+	}
+
+	// enables or disables memoization of conversions of the same object (handle) to c++ integers, floats and strings
+	void cache_conversions(bool enable) {
+		if(!enable) {
+			// keep the hashes, drop the rest
+			for(auto it = immutable_cache.begin(); it != immutable_cache.end();) {
+				if(auto hash = it->second.hash)
+					(it++)->second = {hash, {}, {}, {}};
+				else
+					it = immutable_cache.erase(it);
+			}
+		}
+		conversions_cached = enable;
 	}
 
 	using process_base::terminated;
+	using process_base::resident_memory;
+	using process_base::exited;
+
+	// number of python functions called from c++ so far (including those called by snaketongs itself)
+	std::size_t num_calls() const noexcept {
+		return calls_sent;
+	}
 
 	~process_t() {
 		if(!terminated()) {
@@ -715,6 +1462,148 @@ public:
 		return std::move(b.args);
 	}
 
+	object make_dict(pythonizable_pair_range auto &&pairs) {
+		return cmd_make_dict(FWD(pairs));
+	}
+
+	// n-dimensional array (numpy.ndarray, or a memoryview if numpy is not installed) sent in a single message;
+	// the items are in C order, unless the strides (in items) say otherwise
+	object make_ndarray(const std::ranges::contiguous_range auto &items, const std::vector<std::size_t> &shape, const std::vector<std::size_t> &strides = {})
+	requires array_item<std::ranges::range_value_t<decltype(items)>> {
+		if(!strides.empty() && strides.size() != shape.size())
+			throw std::invalid_argument("Array shape and strides differ in rank");
+		std::size_t used = 1; // one past the last item
+		for(std::size_t dim = 0; dim < shape.size() && used; dim++)
+			used = shape[dim] == 0 ? 0 : strides.empty() ? used * shape[dim] : used + (shape[dim] - 1) * strides[dim];
+		if(used > std::ranges::size(items))
+			throw std::out_of_range("Array shape exceeds the items");
+		return cmd_make_ndarray(std::ranges::data(items), shape, strides);
+	}
+	object make_ndarray(const mdspan_like auto &array) {
+		std::vector<std::size_t> shape, strides;
+		for(std::size_t dim = 0; dim < array.rank(); dim++) {
+			shape.push_back(array.extent(dim));
+			strides.push_back(array.stride(dim));
+		}
+		return cmd_make_ndarray(std::to_address(array.data_handle()), shape, strides);
+	}
+
+	// dict of one-dimensional arrays (see make_ndarray) sent in a single message,
+	// e.g. for pandas.DataFrame or pyarrow.table
+	object make_columns(std::span<const column> columns) {
+		for(const column &c : columns)
+			if(c.size != columns.front().size)
+				throw std::invalid_argument("Columns differ in length");
+		return cmd_make_columns(columns);
+	}
+	object make_columns(std::initializer_list<column> columns) {
+		return make_columns(std::span(columns.begin(), columns.end()));
+	}
+
+	// list of str sent in a single message, instead of a message per string
+	template<std::ranges::forward_range R>
+	requires std::convertible_to<std::ranges::range_reference_t<R>, std::string_view>
+	object make_str_list(R &&strings) {
+		return cmd_make_str_list(strings);
+	}
+	object make_str_list(const string_list &strings) {
+		return cmd_make_str_list(strings.strings());
+	}
+
+	// array of size items in shared memory, see shared_buffer; the interpreter must run on the same machine under the same user
+	template<array_item T>
+	shared_buffer<T> make_shared_buffer(std::size_t size) {
+		if(size == 0)
+			throw std::invalid_argument("Shared buffer cannot be empty");
+		if(size > std::numeric_limits<std::size_t>::max() / sizeof(T))
+			throw std::length_error("Shared buffer too large");
+		char name[SNAKETONGS_SHM_NAME_SIZE];
+		void *memory = snaketongs_impl_shm_create(size * sizeof(T), name);
+		if(!memory)
+			throw io_error("Cannot create shared memory");
+		std::span<T> items(static_cast<T *>(memory), size);
+		try {
+			object array = cmd_map_shared(name, array_item_format<T>(), items.size_bytes());
+			snaketongs_impl_shm_unlink(name);
+			return shared_buffer<T>(items, std::move(array));
+		} catch(...) {
+			snaketongs_impl_shm_unlink(name);
+			snaketongs_impl_shm_unmap(memory, items.size_bytes());
+			throw;
+		}
+	}
+
+	// lazy python iterable over a C++ range, converting chunk_size items at a time (in a single message);
+	// each iteration in python starts over with begin(), an lvalue range is referenced and must outlive the iterable
+	template<std::ranges::viewable_range R>
+	requires std::ranges::input_range<R> && pythonizable<std::ranges::range_reference_t<R>>
+	object make_iterable(R &&range, std::size_t chunk_size = 1024) {
+		if(!chunk_size)
+			throw std::invalid_argument("Iterable chunk size cannot be zero");
+		using view_t = std::views::all_t<R>;
+		auto view = std::make_shared<view_t>(std::views::all(FWD(range)));
+		object begin = make_function<0>([this, view, chunk_size] {
+			auto it = std::make_shared<std::ranges::iterator_t<view_t>>(std::ranges::begin(*view));
+			return make_function<0>([this, view, it, chunk_size] {
+				return cmd_make_list(*it, std::ranges::end(*view), chunk_size);
+			});
+		});
+		return proc["__main__.CppIterable"](begin);
+	}
+
+	// binary file object (io.BufferedReader over an io.RawIOBase) reading data from C++ in chunks of at most chunk_size bytes;
+	// read(buffer) fills (a part of) the buffer and returns the number of bytes, 0 at the end of the data
+	object make_reader(std::invocable<std::span<std::byte>> auto &&read, std::size_t chunk_size = 1 << 16) {
+		object fill = cmd_lambda(cmd_make_remote([read = FWD(read), chunk_size, chunk = std::vector<std::byte>()](process &proc, size_t, const raw_object *args) mutable {
+			object view = proc.cook(args[0]);
+			chunk.resize(std::min<std::size_t>(proc.cmd_get_len(view.raw), chunk_size));
+			std::size_t size = std::min<std::size_t>(read(std::span(chunk)), chunk.size());
+			proc.cmd_ret(proc.cmd_fill(view.raw, chunk.data(), size));
+		}));
+		return proc["io.BufferedReader"](proc["__main__.CppReader"](fill), chunk_size);
+	}
+	object make_reader(istream_like auto &stream, std::size_t chunk_size = 1 << 16) {
+		return make_reader([&stream](std::span<std::byte> buffer) -> std::size_t {
+			stream.read(reinterpret_cast<char *>(buffer.data()), buffer.size());
+			return stream.gcount();
+		}, chunk_size);
+	}
+
+	// binary file object (io.BufferedWriter over an io.RawIOBase) passing data to write(std::span<const std::byte>)
+	// in chunks of (usually) chunk_size bytes; it has to be closed or flushed while the process is still running
+	object make_writer(std::invocable<std::span<const std::byte>> auto &&write, std::size_t chunk_size = 1 << 16) {
+		object drain = cmd_lambda(cmd_make_remote([write = FWD(write)](process &proc, size_t, const raw_object *args) {
+			object view = proc.cook(args[0]);
+			std::vector<unsigned char> data = proc.template cmd_get_ndarray<unsigned char>(view.raw).data;
+			write(std::as_bytes(std::span(data)));
+			proc.cmd_ret(proc.None);
+		}));
+		return proc["io.BufferedWriter"](proc["__main__.CppWriter"](drain), chunk_size);
+	}
+	object make_writer(binary_ostream_like auto &stream, std::size_t chunk_size = 1 << 16) {
+		return make_writer([&stream](std::span<const std::byte> data) {
+			stream.write(reinterpret_cast<const char *>(data.data()), data.size());
+		}, chunk_size);
+	}
+
+	// pickle.loads of the result of object::pickle, possibly from another process instance
+	object unpickle(const pickled &p) {
+		return cmd_unpickle(p);
+	}
+
+	// runs python code with the given arguments bound as local variables and returns its result:
+	// the value of the code if it is a single expression, otherwise the value of a `return` statement (or None);
+	// the code is compiled only once per combination of code and argument names
+	template<typename... V>
+	object run_snippet(std::string_view code, kw_arg<std::string_view, V> &&... args) {
+		return cmd_snippet(code, FWD(args)...);
+	}
+
+	// replays the recorded steps and returns a dict of their results by name (also set as globals of the `snaketongs_init` module)
+	object run_init_script(const init_script &script) {
+		return cmd_init_script(script);
+	}
+
 	template<std::size_t MaxArity, pythonizable_fn<MaxArity> F>
 	object make_function(F &&f) {
 		return cmd_lambda(cmd_make_remote(functor_wrapper<std::remove_cvref_t<F>, MaxArity>(FWD(f))));
@@ -836,6 +1725,38 @@ private:
 #undef object
 
 
+// the result of object::submit, to be retrieved exactly once
+
+class pending_call {
+	process *proc;
+
+	constexpr explicit pending_call(process *proc) noexcept : proc(proc) {}
+
+	friend object;
+	friend void exchange(std::span<pending_call> calls);
+
+public:
+	pending_call(pending_call &&orig) noexcept : proc(std::exchange(orig.proc, nullptr)) {}
+	pending_call &operator=(pending_call &&orig) noexcept {
+		pending_call(std::move(orig)).swap(*this);
+		return *this;
+	}
+
+	void swap(pending_call &other) noexcept {
+		std::swap(proc, other.proc);
+	}
+
+	// waits for the result (unless already received by exchange) and returns it or throws
+	object get();
+
+	bool valid() const noexcept {
+		return proc;
+	}
+
+	~pending_call();
+};
+
+
 ////////////////
 //            //
 //   object   //
@@ -904,12 +1825,9 @@ class object {
 		void del() && {
 			fn_del(obj, FWD(slot));
 		}
-		object update(auto &&f) && requires requires(object o) {{f(o)} -> std::same_as<void>;} {
-			const object &slot_obj = obj.proc->into_object(FWD(slot));
-			object value = fn_get(obj, slot_obj);
-			f(value);
-			fn_set(obj, slot_obj, value);
-			return value;
+		object update(const object &inplace_op, pythonizable auto &&rhs) && {
+			process &proc = *obj.proc;
+			return proc.cmd_update(obj, fn_get, fn_set, proc.into_object(FWD(slot)), inplace_op, proc.into_object(FWD(rhs)));
 		}
 
 		object operator=(pythonizable auto &&rhs) && {
@@ -921,11 +1839,11 @@ class object {
 #define SNAKETONGS_BIN_OP(OP, NAME)
 #define SNAKETONGS_BIN_OP_I(OP, NAME) \
 		object operator OP##=(pythonizable auto &&rhs) && { \
-			return std::move(*this).update([&rhs](object &lhs){ lhs OP##= FWD(rhs); }); \
+			return std::move(*this).update(obj.proc->op_i##NAME, FWD(rhs)); \
 		}
 #define SNAKETONGS_BIN_OP_N(NAME) \
 		object i##NAME(pythonizable auto &&rhs) && { \
-			return std::move(*this).update([&rhs](object &lhs){ lhs.i##NAME(FWD(rhs)); }); \
+			return std::move(*this).update(obj.proc->op_i##NAME, FWD(rhs)); \
 		}
 		SNAKETONGS_GENERATE_BIN_OPS()
 #undef SNAKETONGS_BIN_OP
@@ -949,11 +1867,34 @@ public:
 	explicit operator std::string() const {
 		return proc->cmd_get_bytes<std::string, '\0'>(raw);
 	}
+	// copies a buffer (e.g. numpy.ndarray, memoryview, array.array) in a single message,
+	// converting the item type with numpy if needed
+	template<array_item T>
+	ndarray<T> to_ndarray() const {
+		return proc->cmd_get_ndarray<T>(raw);
+	}
+
+	// copies an iterable of str in a single message
+	string_list to_str_list() const {
+		return proc->cmd_get_str_list(raw);
+	}
+
+	// pickle.dumps with protocol 5, out-of-band buffers are transferred without copying them into the pickle
+	pickled pickle() const {
+		return proc->cmd_pickle(raw);
+	}
+
+	// copies the named one-dimensional columns (obj[name]) of a table in a single message,
+	// e.g. `auto [x, y] = df.to_columns<double, int>("x", "y");`
+	template<array_item... T>
+	std::tuple<std::vector<T>...> to_columns(std::convertible_to<std::string_view> auto &&... names) const
+	requires(sizeof...(T) == sizeof...(names)) {
+		std::array<std::string_view, sizeof...(T)> name_array = {names...};
+		return proc->cmd_get_columns<T...>(raw, name_array);
+	}
+
 	explicit operator double() const {
-		double d;
-		if(std::sscanf(std::string(proc->float_.call("hex", *this)).c_str(), "%la", &d) != 1)
-			throw io_error("float.hex() returned invalid string");
-		return d;
+		return proc->get_float(*this);
 	}
 	explicit operator float() const {
 		return this->operator double();
@@ -983,6 +1924,19 @@ public:
 		}
 	}
 
+	// calls the object without waiting for the result, which is retrieved later by .get() on the returned pending_call;
+	// the process must not be used for anything else until then (see also snaketongs::exchange)
+	pending_call submit(valid_arg auto &&... args) const {
+		if constexpr(none_is_special<decltype(args)...>) {
+			proc->send_call(raw, {proc->into_object(FWD(args)).raw...});
+		} else {
+			args_kwargs_builder<decltype(sizeof...(args))> b = {{*proc}};
+			(..., b.add(FWD(args)));
+			proc->send_starcall(raw, b.args.raw, b.kwargs.raw);
+		}
+		return pending_call(proc);
+	}
+
 	object repr() const {
 		return proc->repr(*this);
 	}
@@ -999,11 +1953,11 @@ public:
 		return proc->format(*this, fmt);
 	}
 	int_t hash() const {
-		return (int_t) proc->hash(*this);
+		return proc->cmd_get_hash(raw);
 	}
 
 	int_t len() const {
-		return (int_t) proc->len(*this);
+		return proc->cmd_get_len(raw);
 	}
 	object iter() const {
 		return proc->iter(*this);
@@ -1048,6 +2002,25 @@ public:
 		item(FWD(index)).del();
 	}
 
+	// bulk versions of getattr, setitem and setattr, sent in a single command
+
+	std::vector<object> get_many(std::span<const std::string_view> names) const {
+		return proc->cmd_get_attrs(raw, names);
+	}
+	template<std::size_t N>
+	std::array<object, N> get_many(const std::string_view (&names)[N]) const {
+		return [values = get_many(std::span(names))]<std::size_t... I>(std::index_sequence<I...>) mutable {
+			return std::array<object, N>{std::move(values[I])...};
+		}(std::make_index_sequence<N>());
+	}
+
+	void update_from(pythonizable_pair_range auto &&pairs) const {
+		proc->cmd_set_items(raw, FWD(pairs));
+	}
+	void set_many(pythonizable_pair_range auto &&pairs) const {
+		proc->cmd_set_attrs(raw, FWD(pairs));
+	}
+
 	// shortcuts for the above
 
 	object operator[](pythonizable auto &&index) const {
@@ -1328,26 +2301,20 @@ struct object_guard : object {
 private:
 	bool released = false;
 	const int num_excs_on_enter = std::uncaught_exceptions();
-	const object manager, enter_fn, exit_fn;
+	const object exit_handle; // (type(manager).__exit__, manager) kept on the python side
 
 	static constexpr const std::string_view
 		msg_unknown_exc = "snaketongs::with destructor cannot retrieve the current exception, catch the exception manually and call .exit()",
 		msg_cannot_suppress = "snaketongs::with destructor cannot suppress exceptions, catch the exception manually and call .exit()";
 
+	object_guard(std::pair<object, object> &&entered) : object(std::move(entered.first)), exit_handle(std::move(entered.second)) {}
+
 public:
 	object_guard(object &&context_manager) :
-		// temporarily use base class subobject for `type(context_manager)`
-		object(context_manager.type()),
 		// 1. expression is evaluated before this ctor is called
-		manager(FWD(context_manager)),
-		// 2. __enter__ is loaded
-		enter_fn(/*manager.type().*/get("__enter__")),
-		// 3. __exit__ is loaded
-		exit_fn(/*manager.type().*/manager.type().get("__exit__")) {
-		// reset base class subobject now before __enter__ is called (in case object.del() throws)
-		operator=(nullptr);
-		// 4. __enter__ is invoked (this may throw, then we should not call __exit__), 5. assign to target (will not throw in our case)
-		operator=(enter_fn(manager));
+		// 2. __enter__ is loaded, 3. __exit__ is loaded, 4. __enter__ is invoked (this may throw, then we should not call __exit__)
+		// - all in a single command, 5. assign to target (will not throw in our case)
+		object_guard(context_manager.get_process().cmd_with_enter(context_manager)) {
 		// 6. after ctor returns, statements are executed, 7. see .exit() and dtor
 	}
 
@@ -1357,13 +2324,12 @@ public:
 		if(released)
 			std::terminate();
 		released = true;
-		process &proc = manager.get_process();
+		process &proc = exit_handle.get_process();
 		auto exc_ptr = std::current_exception();
 		if(!exc_ptr) {
-			exit_fn(manager, proc.None, proc.None, proc.None);
+			proc.cmd_with_exit(exit_handle, proc.None);
 		} else {
-			object exc = proc.make_exception(exc_ptr);
-			if(exit_fn(manager, exc.type(), exc, exc.get("__traceback__")))
+			if(proc.cmd_with_exit(exit_handle, proc.make_exception(exc_ptr)))
 				return;
 			else
 				throw;
@@ -1373,16 +2339,16 @@ public:
 	~object_guard() noexcept(false) {
 		if(released)
 			return;
-		process &proc = manager.get_process();
+		process &proc = exit_handle.get_process();
 		int num_excs_on_exit = std::uncaught_exceptions();
 		if(num_excs_on_enter == num_excs_on_exit) {
 			// no exception in `with` body, leaving normally, exceptions allowed
-			exit_fn(manager, proc.None, proc.None, proc.None);
+			proc.cmd_with_exit(exit_handle, proc.None);
 		} else {
 			// exception thrown in `with` body, pass it to exit, exceptions are caught and printed
 			try {
 				auto UnknownException = proc.type("UnknownException", proc.make_tuple(proc.BaseException), proc.dict());
-				if(exit_fn(manager, UnknownException, UnknownException(msg_unknown_exc), proc.None))
+				if(proc.cmd_with_exit(exit_handle, UnknownException(msg_unknown_exc)))
 					throw proc["builtins.NotImplementedError"](msg_cannot_suppress);
 			} catch(...) {
 				try {
@@ -1393,6 +2359,101 @@ public:
 	}
 };
 
+// disables python's cyclic garbage collector while in scope (nestable), without any additional round trips
+
+class gc_pause {
+	process &proc;
+	const bool collect;
+
+public:
+	// collect: run a full collection when the outermost pause ends, even if the collector stays disabled
+	explicit gc_pause(process &proc, bool collect = false) : proc(proc), collect(collect) {
+		proc.cmd_gc_pause();
+	}
+	gc_pause(const gc_pause &) = delete;
+	void operator=(const gc_pause &) = delete;
+
+	~gc_pause() {
+		if(!proc.terminated()) {
+			try {
+				proc.cmd_gc_resume(collect);
+			} catch(const io_error &) {}
+		}
+	}
+};
+
+// array in memory shared with python, where it is a numpy.ndarray (or a memoryview if numpy is not installed);
+// writes on either side are visible on the other one, python's mapping stays valid until its array is garbage collected
+
+template<array_item T>
+class shared_buffer {
+	std::span<T> items;
+	object array_;
+
+public:
+	shared_buffer(std::span<T> items, object &&array) noexcept : items(items), array_(std::move(array)) {}
+	shared_buffer(shared_buffer &&orig) noexcept : items(std::exchange(orig.items, {})), array_(std::move(orig.array_)) {}
+	shared_buffer &operator=(shared_buffer &&orig) noexcept {
+		std::swap(items, orig.items);
+		std::swap(array_, orig.array_);
+		return *this;
+	}
+
+	~shared_buffer() {
+		if(!items.empty())
+			snaketongs_impl_shm_unmap(items.data(), items.size_bytes());
+	}
+
+	std::span<T> span() const noexcept {
+		return items;
+	}
+	T *data() const noexcept {
+		return items.data();
+	}
+	std::size_t size() const noexcept {
+		return items.size();
+	}
+	T &operator[](std::size_t i) const noexcept {
+		return items[i];
+	}
+	auto begin() const noexcept {
+		return items.begin();
+	}
+	auto end() const noexcept {
+		return items.end();
+	}
+
+	const object &array() const noexcept {
+		return array_;
+	}
+};
+
+inline object pending_call::get() {
+	if(!proc)
+		throw std::logic_error("Result of pending call already retrieved");
+	return std::exchange(proc, nullptr)->wait_for_object();
+}
+
+inline pending_call::~pending_call() {
+	// the response must be consumed anyway, to keep the process usable
+	if(proc && !proc->terminated()) {
+		try {
+			get();
+		} catch(...) {}
+	}
+}
+
+// flushes the calls to all of their processes and waits for all of them at once (using io_uring where available),
+// so that the processes run in parallel and the subsequent .get() calls return without blocking (unless python calls back)
+inline void exchange(std::span<pending_call> calls) {
+	std::vector<process_base *> procs;
+	procs.reserve(calls.size());
+	for(const pending_call &call : calls)
+		if(call.proc)
+			procs.push_back(call.proc);
+	process_base::exchange(procs);
+}
+
 
 ////////////////////////////////////////////////
 //                                            //
@@ -1488,8 +2549,269 @@ namespace snaketongs {
 	using detail::object;
 	using exception = detail::cpp_wrapped_py_exc;
 	using detail::io_error;
+	using detail::resource_limit_error;
+	using detail::server_socket;
+	using detail::start_options;
+	using detail::ndarray;
+	using detail::column;
+	using detail::pickled;
+	using detail::string_list;
+	using detail::shared_buffer;
+	using detail::pending_call;
+	using detail::exchange;
 	using detail::kw;
 	using with = detail::object_guard;
+	using detail::gc_pause;
+	using detail::init_script;
+}
+
+
+
+/////////////////
+//             //
+//   streams   //
+//             //
+/////////////////
+
+namespace snaketongs {
+	// std::streambuf over a python binary file object, transferring chunks of chunk_size bytes per call, e.g.
+	// `snaketongs::pystreambuf buf(proc["gzip.open"]("data.gz")); std::istream in(&buf);`
+	class pystreambuf : public std::streambuf {
+		object file;
+		std::size_t chunk_size;
+		std::string get_area;
+		std::vector<char> put_area;
+
+		// python's write may write less than asked (raw files), or nothing and return None (non-blocking files);
+		// returns how much was written
+		std::size_t write_all(std::span<const char> data) {
+			std::size_t total = 0;
+			while(total < data.size()) {
+				object written = file.call("write", std::as_bytes(data.subspan(total)));
+				if(written.is(file.get_process().None))
+					break;
+				auto count = (std::size_t) written;
+				if(!count || count > data.size() - total)
+					break;
+				total += count;
+			}
+			return total;
+		}
+
+		// the buffered data is dropped even if it could not be written
+		bool write_pending() {
+			std::span<const char> pending(pbase(), pptr());
+			setp(put_area.data(), put_area.data() + put_area.size());
+			return write_all(pending) == pending.size();
+		}
+
+	public:
+		explicit pystreambuf(object file, std::size_t chunk_size = 1 << 16)
+			: file(std::move(file)), chunk_size(chunk_size), put_area(chunk_size) {
+			if(!chunk_size)
+				throw std::invalid_argument("Stream chunk size cannot be zero");
+			setp(put_area.data(), put_area.data() + put_area.size());
+		}
+
+		pystreambuf(const pystreambuf &) = delete;
+		pystreambuf &operator=(const pystreambuf &) = delete;
+
+		// writes the buffered data, but does not close the file
+		~pystreambuf() {
+			try {
+				if(pptr() != pbase())
+					sync();
+			} catch(...) {}
+		}
+
+		const object &python_file() const {
+			return file;
+		}
+
+	protected:
+		int_type underflow() override {
+			get_area = (std::string) file.call("read", chunk_size);
+			if(get_area.empty())
+				return traits_type::eof();
+			setg(get_area.data(), get_area.data(), get_area.data() + get_area.size());
+			return traits_type::to_int_type(get_area[0]);
+		}
+
+		int_type overflow(int_type c) override {
+			if(!write_pending())
+				return traits_type::eof();
+			if(!traits_type::eq_int_type(c, traits_type::eof())) {
+				*pptr() = traits_type::to_char_type(c);
+				pbump(1);
+			}
+			return traits_type::not_eof(c);
+		}
+
+		// large writes skip the buffer
+		std::streamsize xsputn(const char *data, std::streamsize size) override {
+			if((std::size_t) size < chunk_size)
+				return std::streambuf::xsputn(data, size);
+			if(!write_pending())
+				return 0;
+			return write_all(std::span(data, size));
+		}
+
+		int sync() override {
+			if(!write_pending())
+				return -1;
+			file.call("flush");
+			return 0;
+		}
+	};
+}
+
+
+
+//////////////
+//          //
+//   pool   //
+//          //
+//////////////
+
+namespace snaketongs::detail {
+	struct pool_options {
+		std::size_t size = 1;
+		start_options start = {};
+		// a worker over any of these limits is replaced when its lease ends (0 for no limit)
+		std::size_t max_resident_memory = 0;
+		std::size_t max_calls = 0;
+		// replayed on each new worker, then warm_up is called (e.g. to register callbacks)
+		std::optional<init_script> init = {};
+		std::function<void(snaketongs::process &)> warm_up = {};
+	};
+
+	class pool;
+
+	// exclusive use of a worker of a pool, all objects obtained from it must be destroyed before the lease
+	class lease {
+		pool *owner;
+		std::size_t index;
+
+		constexpr lease(pool *owner, std::size_t index) noexcept : owner(owner), index(index) {}
+
+		friend pool;
+
+	public:
+		lease(lease &&orig) noexcept : owner(std::exchange(orig.owner, nullptr)), index(orig.index) {}
+		lease &operator=(lease &&orig) noexcept {
+			lease(std::move(orig)).swap(*this);
+			return *this;
+		}
+
+		void swap(lease &other) noexcept {
+			std::swap(owner, other.owner);
+			std::swap(index, other.index);
+		}
+
+		snaketongs::process &operator*() const;
+		snaketongs::process *operator->() const {
+			return &**this;
+		}
+
+		~lease();
+	};
+
+	// a fixed number of interpreters handed out by leases, transparently recycled when they grow too big or too old
+	class pool {
+		struct worker {
+			std::unique_ptr<snaketongs::process> proc;
+			bool leased = false;
+		};
+
+		const pool_options options;
+		std::vector<worker> workers;
+		std::size_t num_recycled = 0;
+		std::mutex mutex;
+		std::condition_variable released;
+
+		std::unique_ptr<snaketongs::process> start() const {
+			auto proc = std::make_unique<snaketongs::process>(options.start);
+			if(options.init)
+				proc->run_init_script(*options.init);
+			if(options.warm_up)
+				options.warm_up(*proc);
+			return proc;
+		}
+
+		bool over_limits(snaketongs::process &proc) const {
+			if(options.max_calls && proc.num_calls() >= options.max_calls)
+				return true;
+			if(options.max_resident_memory && proc.resident_memory().value_or(0) >= options.max_resident_memory)
+				return true;
+			return proc.terminated() || proc.exited();
+		}
+
+		void release(std::size_t index) noexcept {
+			auto &proc = workers[index].proc; // not accessed by others while leased
+			bool recycle = over_limits(*proc);
+			if(recycle) {
+				try {
+					// the call counter of the fresh worker includes the warm-up
+					proc = start();
+				} catch(...) {
+					// keep the old worker, the replacement will be attempted again next time
+					recycle = false;
+				}
+			}
+			{
+				std::lock_guard lock(mutex);
+				workers[index].leased = false;
+				num_recycled += recycle;
+			}
+			released.notify_one();
+		}
+
+		friend lease;
+
+	public:
+		explicit pool(pool_options options) : options(std::move(options)) {
+			workers.resize(this->options.size);
+			for(auto &w : workers)
+				w.proc = start();
+		}
+		pool(const pool &) = delete;
+		void operator=(const pool &) = delete;
+
+		// waits until a worker is free
+		lease acquire() {
+			std::unique_lock lock(mutex);
+			for(;;) {
+				for(std::size_t i = 0; i < workers.size(); i++) {
+					if(!workers[i].leased) {
+						workers[i].leased = true;
+						return lease(this, i);
+					}
+				}
+				released.wait(lock);
+			}
+		}
+
+		// number of workers replaced so far
+		std::size_t recycled() {
+			std::lock_guard lock(mutex);
+			return num_recycled;
+		}
+	};
+
+	inline snaketongs::process &lease::operator*() const {
+		return *owner->workers[index].proc;
+	}
+
+	inline lease::~lease() {
+		if(owner)
+			owner->release(index);
+	}
+}
+
+namespace snaketongs {
+	using detail::pool_options;
+	using detail::lease;
+	using detail::pool;
 }
 
 template<>
@@ -1499,4 +2821,12 @@ struct std::hash<snaketongs::object> {
 	}
 };
 
+// together with std::hash, allows using objects as keys in std::unordered_map and std::unordered_set
+template<>
+struct std::equal_to<snaketongs::object> {
+	bool operator()(const snaketongs::object &a, const snaketongs::object &b) const {
+		return (bool) (a == b);
+	}
+};
+
 #endif
@@ -2,6 +2,9 @@
 #define SNAKETONGS_SUBPROC_H_
 
 #include <stddef.h>
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
 
 #ifdef __cplusplus
 namespace snaketongs::detail {
@@ -10,12 +13,58 @@ extern "C" {
 
 struct snaketongs_impl;
 
+struct snaketongs_impl_options {
+	const char *python; // NULL or empty for the default
+	// CPUs the interpreter may run on (NULL for no restriction)
+	const int *cpus;
+	size_t num_cpus;
+	// restricts the CPUs further to those sharing the last level cache with the calling thread
+	bool near_caller;
+	// also pins the calling thread to the CPUs chosen for the interpreter
+	bool pin_caller;
+	// disables the cyclic garbage collector of the interpreter
+	bool gc_disable;
+	// gc.set_threshold() arguments for the interpreter (NULL for the defaults, otherwise 3 values)
+	const int *gc_thresholds;
+	// resource limits of the interpreter (0 for no limit): RLIMIT_AS in bytes, RLIMIT_CPU in seconds
+	size_t max_memory;
+	unsigned max_cpu_seconds;
+	// cgroup v2 to move the interpreter to (absolute or relative to /sys/fs/cgroup, NULL for none)
+	const char *cgroup;
+	// directory to cache module locations in across interpreter instances (NULL for no cache)
+	const char *import_cache;
+};
+
 struct snaketongs_impl *snaketongs_impl_start(const char *python, int int_size);
+struct snaketongs_impl *snaketongs_impl_start_with(const struct snaketongs_impl_options *options, int int_size);
+struct snaketongs_impl *snaketongs_impl_connect(const char *socket_path, int int_size);
 bool snaketongs_impl_send(struct snaketongs_impl *self, const void *src, size_t size);
 bool snaketongs_impl_flush(struct snaketongs_impl *self);
 bool snaketongs_impl_recv(struct snaketongs_impl *self, void *dest, size_t size);
 bool snaketongs_impl_quit(struct snaketongs_impl *self);
 
+// how the interpreter ended (without reaping it): returns false if it is still running or unknown (e.g. when connected to a server),
+// otherwise sets *signal to the signal that killed it (0 if it exited) and *status to its exit status
+bool snaketongs_impl_exit_status(struct snaketongs_impl *self, int *status, int *signal);
+
+// after a failure, whether the interpreter was killed for exceeding the limits it was started with
+bool snaketongs_impl_limit_exceeded(struct snaketongs_impl *self);
+
+// resident set size of the interpreter in bytes, 0 if unknown (e.g. when connected to a server)
+size_t snaketongs_impl_rss(struct snaketongs_impl *self);
+
+// shared memory of the given size (not 0), zero-filled and mapped read-write, that the interpreter can map by its name
+// (of at most SNAKETONGS_SHM_NAME_SIZE bytes including the terminator); returns NULL on failure
+#define SNAKETONGS_SHM_NAME_SIZE 64
+void *snaketongs_impl_shm_create(size_t size, char *name);
+// removes the name once the interpreter has mapped the memory, the mappings stay valid
+void snaketongs_impl_shm_unlink(const char *name);
+void snaketongs_impl_shm_unmap(void *memory, size_t size);
+
+// sends the buffered data of each instance and then waits until each instance that was sent something has data to receive,
+// using a single io_uring_enter for all of them where available
+bool snaketongs_impl_exchange_many(struct snaketongs_impl *const *selves, size_t count);
+
 #ifdef __cplusplus
 }
 }
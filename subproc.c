@@ -1,10 +1,33 @@
+#define _GNU_SOURCE // sched_setaffinity, sched_getcpu
+
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && !defined(SNAKETONGS_NO_IO_URING) && __has_include(<linux/io_uring.h>)
+#define SNAKETONGS_IO_URING
+#include <linux/io_uring.h>
+#include <pthread.h>
+#endif
+
 #include "include/snaketongs_subproc.h"
 
 #if __STDC_VERSION__ >= 201112L
@@ -24,15 +47,30 @@
 #define noinline
 #endif
 
-static const char python_script[] =
+static const char python_script[] = {
 #include "entry.py.str.h"
-;
+	0
+};
+
+enum {
+	BufSize = 8192,
+};
 
 struct snaketongs_impl {
-	pid_t pid;
-	FILE *cpp_to_py;
-	FILE *py_to_cpp;
+	pid_t pid; // NoChild when connected to a server
+	int pidfd; // -1 if not available, otherwise py_to_cpp is non-blocking and both are polled together
+	bool limited; // started with resource limits
+	// how the child ended, once known (it is left as a zombie until wait_for_python)
+	bool exited;
+	int exit_status, exit_signal;
+	int cpp_to_py; // both fds are the same socket when connected to a server
+	int py_to_cpp;
 	bool err;
+	// own buffering instead of stdio, so that several instances can be flushed/filled at once
+	size_t send_len;
+	size_t recv_pos, recv_len;
+	unsigned char send_buf[BufSize];
+	unsigned char recv_buf[BufSize];
 };
 
 enum {
@@ -45,7 +83,10 @@ enum {
 	ForkChild = 0,
 };
 
-static noinline noreturn void exec_python(const char *python, int cpp_to_py, int py_to_cpp, int int_size) {
+static const pid_t NoChild = -1;
+
+static noinline noreturn void exec_python(const struct snaketongs_impl_options *options, int cpp_to_py, int py_to_cpp, int int_size) {
+	const char *python = options->python;
 	if(!python || !*python)
 		python = getenv("PYTHON");
 	if(!python || !*python)
@@ -59,11 +100,236 @@ static noinline noreturn void exec_python(const char *python, int cpp_to_py, int
 	sprintf(py_to_cpp_decimal, "%i", py_to_cpp);
 	sprintf(int_size_decimal, "%i", int_size);
 
-	execlp(python, python, "-c", python_script, cpp_to_py_decimal, py_to_cpp_decimal, int_size_decimal, NULL);
+	// key=value options for entry.py
+	char gc_option[sizeof "gc=,," + 3 * 3 * sizeof(int)];
+	if(options->gc_disable)
+		strcpy(gc_option, "gc=off");
+	else if(options->gc_thresholds)
+		sprintf(gc_option, "gc=%i,%i,%i", options->gc_thresholds[0], options->gc_thresholds[1], options->gc_thresholds[2]);
+
+	const char *import_cache = options->import_cache;
+	char import_cache_option[sizeof "import_cache=" + (import_cache ? strlen(import_cache) : 0)];
+	if(import_cache)
+		sprintf(import_cache_option, "import_cache=%s", import_cache);
+
+	const char *argv[9] = {python, "-c", python_script, cpp_to_py_decimal, py_to_cpp_decimal, int_size_decimal};
+	int argc = 6;
+	if(options->gc_disable || options->gc_thresholds)
+		argv[argc++] = gc_option;
+	if(import_cache)
+		argv[argc++] = import_cache_option;
+	argv[argc] = NULL;
+	execvp(python, (char *const *) argv);
 	perror("Cannot execute Python interpreter");
 	exit(127);
 }
 
+// CPU placement
+
+#ifdef __linux__
+
+// parses a file in the kernel's cpu list format, e.g. "0-3,8,10-11"
+static bool read_cpu_list(const char *path, cpu_set_t *set) {
+	FILE *f = fopen(path, "r");
+	if(!f)
+		return false;
+	CPU_ZERO(set);
+	bool ok = true;
+	for(;;) {
+		unsigned first, last;
+		if(fscanf(f, "%u", &first) != 1) {
+			ok = false;
+			break;
+		}
+		last = first;
+		int c = fgetc(f);
+		if(c == '-') {
+			if(fscanf(f, "%u", &last) != 1) {
+				ok = false;
+				break;
+			}
+			c = fgetc(f);
+		}
+		for(unsigned cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+			CPU_SET(cpu, set);
+		if(c != ',')
+			break;
+	}
+	fclose(f);
+	return ok;
+}
+
+// the CPUs sharing the last level cache with the CPU the calling thread currently runs on
+static bool get_near_cpus(cpu_set_t *set) {
+	int cpu = sched_getcpu();
+	if(cpu == -1)
+		return false;
+	bool found = false;
+	for(int index = 0;; index++) {
+		char path[sizeof "/sys/devices/system/cpu/cpu/cache/index/shared_cpu_list" + 2 * 3 * sizeof(int)];
+		sprintf(path, "/sys/devices/system/cpu/cpu%i/cache/index%i/shared_cpu_list", cpu, index);
+		cpu_set_t level;
+		if(!read_cpu_list(path, &level))
+			return found;
+		*set = level;
+		found = true;
+	}
+}
+
+// returns false on error, sets *restricted to whether the set should be applied at all
+static bool choose_cpus(const struct snaketongs_impl_options *options, cpu_set_t *set, bool *restricted) {
+	*restricted = false;
+	if(options->cpus) {
+		CPU_ZERO(set);
+		for(size_t i = 0; i < options->num_cpus; i++) {
+			if(options->cpus[i] < 0 || options->cpus[i] >= CPU_SETSIZE) {
+				fprintf(stderr, "snaketongs_impl_start: invalid CPU %i\n", options->cpus[i]);
+				return false;
+			}
+			CPU_SET(options->cpus[i], set);
+		}
+		*restricted = true;
+	}
+	if(options->near_caller) {
+		cpu_set_t near;
+		if(get_near_cpus(&near)) {
+			if(*restricted)
+				CPU_AND(set, set, &near);
+			else
+				*set = near;
+			*restricted = true;
+		}
+		// otherwise the cache topology is unknown, do not restrict anything
+	}
+	if(*restricted && !CPU_COUNT(set)) {
+		fputs("snaketongs_impl_start: no CPU left to run on\n", stderr);
+		return false;
+	}
+	return true;
+}
+
+#else
+
+typedef int cpu_set_t; // never used
+
+static bool choose_cpus(const struct snaketongs_impl_options *options, cpu_set_t *set, bool *restricted) {
+	(void) set;
+	*restricted = false;
+	if(options->cpus || options->near_caller) {
+		fputs("snaketongs_impl_start: CPU affinity is only supported on Linux\n", stderr);
+		return false;
+	}
+	return true;
+}
+
+static int sched_setaffinity(pid_t pid, size_t size, const cpu_set_t *set) {
+	(void) pid;
+	(void) size;
+	(void) set;
+	errno = ENOSYS;
+	return -1;
+}
+
+#endif
+
+// resource limits and cgroup placement, in the child before exec
+
+static bool set_limit(int resource, rlim_t value, const char *name) {
+	struct rlimit limit = {.rlim_cur = value, .rlim_max = value};
+	if(setrlimit(resource, &limit)) {
+		fprintf(stderr, "snaketongs_impl_start: setrlimit %s: %s\n", name, strerror(errno));
+		return false;
+	}
+	return true;
+}
+
+static bool enter_cgroup(const char *cgroup) {
+	// writing 0 moves the writing process itself
+	char path[4096];
+	if(snprintf(path, sizeof path, "%s%s/cgroup.procs", cgroup[0] == '/' ? "" : "/sys/fs/cgroup/", cgroup) >= (int) sizeof path) {
+		fputs("snaketongs_impl_start: cgroup path too long\n", stderr);
+		return false;
+	}
+	int fd = open(path, O_WRONLY | O_CLOEXEC);
+	if(fd == -1 || write(fd, "0", 1) != 1) {
+		fprintf(stderr, "snaketongs_impl_start: cannot enter cgroup %s: %s\n", path, strerror(errno));
+		return false;
+	}
+	close(fd);
+	return true;
+}
+
+static bool apply_limits(const struct snaketongs_impl_options *options) {
+	if(options->cgroup && !enter_cgroup(options->cgroup))
+		return false;
+	if(options->max_memory && !set_limit(RLIMIT_AS, options->max_memory, "RLIMIT_AS"))
+		return false;
+	if(options->max_cpu_seconds && !set_limit(RLIMIT_CPU, options->max_cpu_seconds, "RLIMIT_CPU"))
+		return false;
+	return true;
+}
+
+// close-on-exec, so that interpreters started concurrently from other threads do not inherit each other's pipes
+static int open_pipe(int fds[2]) {
+#ifdef __linux__
+	return pipe2(fds, O_CLOEXEC);
+#else
+	if(pipe(fds))
+		return -1;
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+	fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+	return 0;
+#endif
+}
+
+static int open_pidfd(pid_t pid) {
+#if defined(__linux__) && defined(SYS_pidfd_open)
+	return syscall(SYS_pidfd_open, pid, 0);
+#else
+	(void) pid;
+	errno = ENOSYS;
+	return -1;
+#endif
+}
+
+// records how the child ended if it already has, waiting up to timeout_ms for it
+static bool peek_exit(struct snaketongs_impl *self, int timeout_ms) {
+	if(self->exited || self->pid == NoChild)
+		return self->exited;
+	if(timeout_ms && self->pidfd != -1) {
+		// readable once the process has ended
+		struct pollfd pfd = {.fd = self->pidfd, .events = POLLIN};
+		poll(&pfd, 1, timeout_ms);
+		timeout_ms = 0;
+	}
+	for(int attempt = 0;; attempt++) {
+		siginfo_t info;
+		info.si_pid = 0;
+		// WNOWAIT leaves the zombie for wait_for_python
+		if(waitid(P_PID, self->pid, &info, WEXITED | WNOHANG | WNOWAIT))
+			return false;
+		if(info.si_pid) {
+			self->exited = true;
+			self->exit_status = info.si_code == CLD_EXITED ? info.si_status : 0;
+			self->exit_signal = info.si_code == CLD_EXITED ? 0 : info.si_status;
+			return true;
+		}
+		if(attempt >= timeout_ms)
+			return false;
+		usleep(1000);
+	}
+}
+
+static void init_buffers(struct snaketongs_impl *self, int cpp_to_py, int py_to_cpp) {
+	self->cpp_to_py = cpp_to_py;
+	self->py_to_cpp = py_to_cpp;
+	self->pidfd = -1;
+	self->exited = false;
+	self->err = false;
+	self->send_len = 0;
+	self->recv_pos = self->recv_len = 0;
+}
+
 static bool wait_for_python(pid_t pid) {
 	siginfo_t info;
 	if(waitid(P_PID, pid, &info, WEXITED)) {
@@ -78,12 +344,17 @@ static bool wait_for_python(pid_t pid) {
 			return false;
 		}
 	} else { // signal
-		fprintf(stderr, "Python interpreter (pid %i) killed by signal %i", (int) pid, (int) info.si_status);
+		fprintf(stderr, "Python interpreter (pid %i) killed by signal %i\n", (int) pid, (int) info.si_status);
 		return false;
 	}
 }
 
 struct snaketongs_impl *snaketongs_impl_start(const char *python, int int_size) {
+	struct snaketongs_impl_options options = {.python = python};
+	return snaketongs_impl_start_with(&options, int_size);
+}
+
+struct snaketongs_impl *snaketongs_impl_start_with(const struct snaketongs_impl_options *options, int int_size) {
 	struct snaketongs_impl *self = (struct snaketongs_impl *) malloc(sizeof *self);
 	if(!self) {
 		// avoid using stdio in case of oom
@@ -91,12 +362,20 @@ struct snaketongs_impl *snaketongs_impl_start(const char *python, int int_size)
 		write(STDERR_FILENO, msg, sizeof msg - 1);
 		goto error0;
 	}
+	cpu_set_t cpus;
+	bool restrict_cpus;
+	if(!choose_cpus(options, &cpus, &restrict_cpus))
+		goto error1;
+	if(restrict_cpus && options->pin_caller && sched_setaffinity(0, sizeof cpus, &cpus)) {
+		perror("snaketongs_impl_start: sched_setaffinity");
+		goto error1;
+	}
 	int cpp_to_py[2], py_to_cpp[2];
-	if(pipe(cpp_to_py)) {
+	if(open_pipe(cpp_to_py)) {
 		perror("snaketongs_impl_start: pipe");
 		goto error1;
 	}
-	if(pipe(py_to_cpp)) {
+	if(open_pipe(py_to_cpp)) {
 		perror("snaketongs_impl_start: pipe");
 		goto error2;
 	}
@@ -104,7 +383,13 @@ struct snaketongs_impl *snaketongs_impl_start(const char *python, int int_size)
 		case ForkChild:
 			if(close(cpp_to_py[WriteEnd]) | close(py_to_cpp[ReadEnd]))
 				perror("snaketongs_impl_start: close"), _exit(127);
-			exec_python(python, cpp_to_py[ReadEnd], py_to_cpp[WriteEnd], int_size);
+			if(fcntl(cpp_to_py[ReadEnd], F_SETFD, 0) | fcntl(py_to_cpp[WriteEnd], F_SETFD, 0))
+				perror("snaketongs_impl_start: fcntl"), _exit(127);
+			if(restrict_cpus && sched_setaffinity(0, sizeof cpus, &cpus))
+				perror("snaketongs_impl_start: sched_setaffinity"), _exit(127);
+			if(!apply_limits(options))
+				_exit(127);
+			exec_python(options, cpp_to_py[ReadEnd], py_to_cpp[WriteEnd], int_size);
 			// noreturn
 		case ForkError:
 			perror("snaketongs_impl_start: fork");
@@ -134,22 +419,15 @@ struct snaketongs_impl *snaketongs_impl_start(const char *python, int int_size)
 				abort();
 		}
 	}
-	self->cpp_to_py = fdopen(cpp_to_py[WriteEnd], "wb");
-	if(!self->cpp_to_py) {
-		perror("snaketongs_impl_start: fdopen wb");
-		goto error4;
-	}
-	self->py_to_cpp = fdopen(py_to_cpp[ReadEnd], "rb");
-	if(!self->py_to_cpp) {
-		perror("snaketongs_impl_start: fdopen rb");
-		goto error5;
+	init_buffers(self, cpp_to_py[WriteEnd], py_to_cpp[ReadEnd]);
+	self->limited = options->max_memory || options->max_cpu_seconds || options->cgroup;
+	// optional, detects the death of the child even if it has passed the pipe on to its own children
+	self->pidfd = open_pidfd(self->pid);
+	if(self->pidfd != -1 && fcntl(self->py_to_cpp, F_SETFL, fcntl(self->py_to_cpp, F_GETFL) | O_NONBLOCK)) {
+		close(self->pidfd);
+		self->pidfd = -1;
 	}
-	self->err = false;
 	return self;
-error5:
-	// close the parent end of each pipe
-	fclose(self->cpp_to_py);
-	close(py_to_cpp[ReadEnd]);
 error4:
 	// close the parent end of each pipe
 	close(cpp_to_py[WriteEnd]);
@@ -175,71 +453,596 @@ error0:
 	return NULL;
 }
 
-bool snaketongs_impl_send(struct snaketongs_impl *self, const void *src, size_t size) {
-	if(self->err)
+struct snaketongs_impl *snaketongs_impl_connect(const char *socket_path, int int_size) {
+	struct snaketongs_impl *self = (struct snaketongs_impl *) malloc(sizeof *self);
+	if(!self) {
+		// avoid using stdio in case of oom
+		static const char msg[] = "snaketongs_impl_connect: out of memory\n";
+		write(STDERR_FILENO, msg, sizeof msg - 1);
+		goto error0;
+	}
+	self->pid = NoChild;
+	self->limited = false;
+	struct sockaddr_un addr = {.sun_family = AF_UNIX};
+	if(strlen(socket_path) >= sizeof addr.sun_path) {
+		fputs("snaketongs_impl_connect: socket path too long\n", stderr);
+		goto error1;
+	}
+	strcpy(addr.sun_path, socket_path);
+	// close-on-exec like the pipes, an interpreter started later must not keep the session alive
+#ifdef SOCK_CLOEXEC
+	int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+#else
+	int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(sock != -1)
+		fcntl(sock, F_SETFD, FD_CLOEXEC);
+#endif
+	if(sock == -1) {
+		perror("snaketongs_impl_connect: socket");
+		goto error1;
+	}
+	if(connect(sock, (struct sockaddr *) &addr, sizeof addr)) {
+		perror("snaketongs_impl_connect: connect");
+		goto error2;
+	}
+	// the server forks a session for us, tell it our int size and check it started correctly
+	{
+		unsigned char c = int_size;
+		if(write(sock, &c, 1) != 1) {
+			perror("snaketongs_impl_connect: write");
+			goto error2;
+		}
+		switch(read(sock, &c, 1)) {
+			case -1:
+				perror("snaketongs_impl_connect: read");
+				goto error2;
+			case 0:
+				fputs("snaketongs_impl_connect: server closed the connection\n", stderr);
+				goto error2;
+			case 1:
+				if(c == '+')
+					break; // ok
+				fputs("snaketongs_impl_connect: unexpected server output\n", stderr);
+				goto error2;
+			default:
+				abort();
+		}
+	}
+	init_buffers(self, sock, sock);
+	return self;
+error2:
+	close(sock);
+error1:
+	free(self);
+error0:
+	return NULL;
+}
+
+bool snaketongs_impl_exit_status(struct snaketongs_impl *self, int *status, int *signal) {
+	// after a failure, the pipe may have been closed slightly before the process became a zombie, so give it a moment
+	if(!peek_exit(self, self->err ? 100 : 0))
 		return false;
-	if(!size)
-		return true;
-	errno = 0;
-	switch(fwrite(src, size, 1, self->cpp_to_py)) {
-		case 1:
-			return true;
-		case 0:
-			if(errno)
-				perror("snaketongs_impl_send");
-			else
-				fputs("snaketongs_impl_send failed\n", stderr);
+	*status = self->exit_status;
+	*signal = self->exit_signal;
+	return true;
+}
+
+bool snaketongs_impl_limit_exceeded(struct snaketongs_impl *self) {
+	int status, signal;
+	// SIGXCPU for RLIMIT_CPU, SIGKILL for the RLIMIT_CPU hard limit or the OOM killer of the cgroup
+	return self->limited && snaketongs_impl_exit_status(self, &status, &signal) && (signal == SIGXCPU || signal == SIGKILL);
+}
+
+size_t snaketongs_impl_rss(struct snaketongs_impl *self) {
+	if(self->pid == NoChild)
+		return 0;
+	char path[sizeof "/proc//statm" + 3 * sizeof(pid_t)];
+	sprintf(path, "/proc/%i/statm", (int) self->pid);
+	FILE *f = fopen(path, "r");
+	if(!f)
+		return 0;
+	unsigned long pages;
+	if(fscanf(f, "%*u %lu", &pages) != 1)
+		pages = 0;
+	fclose(f);
+	return pages * sysconf(_SC_PAGESIZE);
+}
+
+// shared memory
+
+void *snaketongs_impl_shm_create(size_t size, char *name) {
+	static atomic_uint counter;
+	snprintf(name, SNAKETONGS_SHM_NAME_SIZE, "/snaketongs-%i-%u", (int) getpid(), atomic_fetch_add(&counter, 1));
+	int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if(fd == -1) {
+		perror("snaketongs_impl_shm_create: shm_open");
+		return NULL;
+	}
+	void *memory = MAP_FAILED;
+	if(ftruncate(fd, size))
+		perror("snaketongs_impl_shm_create: ftruncate");
+	else if((memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED)
+		perror("snaketongs_impl_shm_create: mmap");
+	close(fd);
+	if(memory == MAP_FAILED) {
+		shm_unlink(name);
+		return NULL;
+	}
+	return memory;
+}
+
+void snaketongs_impl_shm_unlink(const char *name) {
+	if(shm_unlink(name))
+		perror("snaketongs_impl_shm_unlink");
+}
+
+void snaketongs_impl_shm_unmap(void *memory, size_t size) {
+	if(munmap(memory, size))
+		perror("snaketongs_impl_shm_unmap");
+}
+
+// low-level i/o, setting self->err on failure
+
+static bool write_all(struct snaketongs_impl *self, const unsigned char *src, size_t size) {
+	while(size) {
+		ssize_t written = write(self->cpp_to_py, src, size);
+		if(written == -1) {
+			if(errno == EINTR)
+				continue;
+			perror("snaketongs_impl_send");
 			self->err = true;
 			return false;
-		default:
-			abort();
+		}
+		src += written;
+		size -= written;
 	}
+	return true;
 }
 
-bool snaketongs_impl_flush(struct snaketongs_impl *self) {
-	if(self->err)
-		return false;
-	switch(fflush(self->cpp_to_py)) {
-		case 0:
-			return true;
-		case -1:
-			perror("snaketongs_impl_flush");
+// only with a pidfd: waits for data, or for the child to end
+static bool wait_readable(struct snaketongs_impl *self) {
+	struct pollfd fds[2] = {
+		{.fd = self->py_to_cpp, .events = POLLIN},
+		{.fd = self->pidfd, .events = POLLIN},
+	};
+	while(poll(fds, 2, -1) == -1) {
+		if(errno != EINTR) {
+			perror("snaketongs_impl_recv: poll");
 			self->err = true;
 			return false;
-		default:
-			abort();
+		}
 	}
+	if(fds[0].revents || !fds[1].revents)
+		return true; // data or eof
+	peek_exit(self, 0);
+	fputs("snaketongs_impl_recv: Python interpreter terminated\n", stderr);
+	self->err = true;
+	return false;
 }
 
-bool snaketongs_impl_recv(struct snaketongs_impl *self, void *dest, size_t size) {
+static ssize_t read_some(struct snaketongs_impl *self, unsigned char *dest, size_t size) {
+	for(;;) {
+		ssize_t got = read(self->py_to_cpp, dest, size);
+		if(got == -1 && errno == EINTR)
+			continue;
+		if(got == -1 && errno == EAGAIN) {
+			// non-blocking because of the pidfd, no syscall is added when the data is already there
+			if(!wait_readable(self))
+				return -1;
+			continue;
+		}
+		if(got == -1)
+			perror("snaketongs_impl_recv");
+		else if(got == 0)
+			fputs("snaketongs_impl_recv failed\n", stderr);
+		else
+			return got;
+		self->err = true;
+		return -1;
+	}
+}
+
+// the pipe interface
+
+bool snaketongs_impl_send(struct snaketongs_impl *self, const void *src, size_t size) {
 	if(self->err)
 		return false;
-	if(!size)
+	if(size <= BufSize - self->send_len) {
+		memcpy(self->send_buf + self->send_len, src, size);
+		self->send_len += size;
 		return true;
-	errno = 0;
-	switch(fread(dest, size, 1, self->py_to_cpp)) {
-		case 1:
-			return true;
-		case 0:
-			if(errno)
-				perror("snaketongs_impl_recv");
-			else
-				fputs("snaketongs_impl_recv failed\n", stderr);
-			self->err = true;
+	}
+	if(!snaketongs_impl_flush(self))
+		return false;
+	if(size >= BufSize)
+		return write_all(self, (const unsigned char *) src, size);
+	memcpy(self->send_buf, src, size);
+	self->send_len = size;
+	return true;
+}
+
+bool snaketongs_impl_flush(struct snaketongs_impl *self) {
+	if(self->err)
+		return false;
+	size_t len = self->send_len;
+	self->send_len = 0;
+	return write_all(self, self->send_buf, len);
+}
+
+bool snaketongs_impl_recv(struct snaketongs_impl *self, void *dest, size_t size) {
+	unsigned char *d = (unsigned char *) dest;
+	for(;;) {
+		if(self->err)
 			return false;
-		default:
-			abort();
+		size_t buffered = self->recv_len - self->recv_pos;
+		if(size <= buffered) {
+			memcpy(d, self->recv_buf + self->recv_pos, size);
+			self->recv_pos += size;
+			return true;
+		}
+		memcpy(d, self->recv_buf + self->recv_pos, buffered);
+		d += buffered;
+		size -= buffered;
+		self->recv_pos = self->recv_len = 0;
+		if(size >= BufSize) {
+			// large reads bypass the buffer
+			ssize_t got = read_some(self, d, size);
+			if(got > 0)
+				d += got, size -= got;
+		} else {
+			ssize_t got = read_some(self, self->recv_buf, BufSize);
+			if(got > 0)
+				self->recv_len = got;
+		}
 	}
 }
 
 bool snaketongs_impl_quit(struct snaketongs_impl *self) {
-	bool ok = true;
-	if(fclose(self->cpp_to_py))
+	// like fclose, write out what is left in the buffer (e.g. the command that makes python exit)
+	bool ok = !self->send_len || snaketongs_impl_flush(self);
+	if(close(self->cpp_to_py))
 		perror("snaketongs_impl_quit cpp_to_py"), ok = false;
-	if(fclose(self->py_to_cpp))
+	if(self->py_to_cpp != self->cpp_to_py && close(self->py_to_cpp))
 		perror("snaketongs_impl_quit py_to_cpp"), ok = false;
-	if(!wait_for_python(self->pid))
+	if(self->pidfd != -1)
+		close(self->pidfd);
+	if(self->pid != NoChild && !wait_for_python(self->pid))
 		ok = false;
 	free(self);
 	return ok;
 }
+
+// batched i/o for many instances
+
+static bool needs_recv(struct snaketongs_impl *self, bool sent) {
+	// only wait for instances that have just been sent something, otherwise there may be nothing to wait for
+	return sent && !self->err && self->recv_pos == self->recv_len;
+}
+
+static bool exchange_many_fallback(struct snaketongs_impl *const *selves, size_t count) {
+	bool ok = true;
+	bool *sent = (bool *) calloc(count ? count : 1, sizeof *sent);
+	if(!sent)
+		return false;
+	for(size_t i = 0; i < count; i++) {
+		sent[i] = selves[i]->send_len;
+		if(!snaketongs_impl_flush(selves[i]))
+			ok = false;
+	}
+	for(size_t i = 0; i < count; i++) {
+		struct snaketongs_impl *self = selves[i];
+		if(!needs_recv(self, sent[i]))
+			continue;
+		ssize_t got = read_some(self, self->recv_buf, BufSize);
+		if(got > 0) {
+			self->recv_pos = 0;
+			self->recv_len = got;
+		} else {
+			ok = false;
+		}
+	}
+	free(sent);
+	return ok;
+}
+
+#ifdef SNAKETONGS_IO_URING
+
+// a minimal io_uring wrapper (without liburing), one ring per thread shared by the instances it exchanges with
+
+enum {
+	RingMinEntries = 256, // submission queue entries, the ring grows with the batches up to the kernel's limit
+	RingMaxEntries = 32768,
+	RingEntriesPerInstance = 5, // a write, a poll and a read, a poll of the pidfd, and the removal of one of the polls
+};
+
+static _Thread_local struct ring {
+	bool initialized, unavailable, cannot_grow;
+	int fd;
+	unsigned entries, unsubmitted;
+	unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+	unsigned *cq_head, *cq_tail, *cq_mask;
+	struct io_uring_sqe *sqes;
+	struct io_uring_cqe *cqes;
+	unsigned char *sq_map, *cq_map; // for ring_free
+	size_t sq_size, cq_size, sqes_size;
+} ring;
+
+// frees the ring of an exiting thread, the key's value points to that thread's ring
+static pthread_key_t ring_key;
+static pthread_once_t ring_key_once = PTHREAD_ONCE_INIT;
+static bool ring_key_created; // otherwise the rings are kept until exit
+
+static void ring_free(void *value) {
+	struct ring *r = (struct ring *) value;
+	munmap(r->sqes, r->sqes_size);
+	if(r->cq_map != r->sq_map)
+		munmap(r->cq_map, r->cq_size);
+	munmap(r->sq_map, r->sq_size);
+	close(r->fd);
+}
+
+static void ring_key_create(void) {
+	ring_key_created = !pthread_key_create(&ring_key, ring_free);
+}
+
+// IORING_OP_READ and IORING_OP_WRITE only exist since Linux 5.6, older kernels accept the ring but fail every read
+static bool ring_supports_ops(int fd) {
+	static const unsigned char needed[] = {IORING_OP_POLL_ADD, IORING_OP_POLL_REMOVE, IORING_OP_READ, IORING_OP_WRITE};
+	size_t size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+	struct io_uring_probe *probe = calloc(1, size);
+	if(!probe)
+		return false;
+	bool ok = syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+	for(size_t i = 0; ok && i < sizeof needed; i++)
+		ok = needed[i] <= probe->last_op && (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+	free(probe);
+	return ok;
+}
+
+static bool ring_init(size_t entries) {
+	struct io_uring_params params;
+	memset(&params, 0, sizeof params);
+	params.flags = IORING_SETUP_CLAMP;
+	if(entries < RingMinEntries)
+		entries = RingMinEntries;
+	int fd = syscall(__NR_io_uring_setup, entries < RingMaxEntries ? (unsigned) entries : RingMaxEntries, &params);
+	if(fd == -1)
+		return false;
+	if(!ring_supports_ops(fd))
+		goto error1;
+	size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+	if(single_mmap)
+		sq_size = cq_size = sq_size > cq_size ? sq_size : cq_size;
+	unsigned char *sq = mmap(NULL, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if(sq == MAP_FAILED)
+		goto error1;
+	unsigned char *cq = single_mmap ? sq : mmap(NULL, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+	if(cq == MAP_FAILED)
+		goto error2;
+	size_t sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring.sqes = mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	if(ring.sqes == MAP_FAILED)
+		goto error3;
+	ring.fd = fd;
+	ring.entries = params.sq_entries;
+	ring.unsubmitted = 0;
+	ring.sq_map = sq;
+	ring.cq_map = cq;
+	ring.sq_size = sq_size;
+	ring.cq_size = cq_size;
+	ring.sqes_size = sqes_size;
+	ring.sq_head = (unsigned *) (sq + params.sq_off.head);
+	ring.sq_tail = (unsigned *) (sq + params.sq_off.tail);
+	ring.sq_mask = (unsigned *) (sq + params.sq_off.ring_mask);
+	ring.sq_array = (unsigned *) (sq + params.sq_off.array);
+	ring.cq_head = (unsigned *) (cq + params.cq_off.head);
+	ring.cq_tail = (unsigned *) (cq + params.cq_off.tail);
+	ring.cq_mask = (unsigned *) (cq + params.cq_off.ring_mask);
+	ring.cqes = (struct io_uring_cqe *) (cq + params.cq_off.cqes);
+	pthread_once(&ring_key_once, ring_key_create);
+	if(ring_key_created)
+		pthread_setspecific(ring_key, &ring);
+	return true;
+error3:
+	if(!single_mmap)
+		munmap(cq, cq_size);
+error2:
+	munmap(sq, sq_size);
+error1:
+	close(fd);
+	return false;
+}
+
+// submits the queued entries and waits for at least min_complete completions, returns the number submitted or -1
+static int ring_enter(unsigned min_complete) {
+	int entered;
+	do
+		entered = syscall(__NR_io_uring_enter, ring.fd, ring.unsubmitted, min_complete, min_complete ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+	while(entered == -1 && errno == EINTR);
+	if(entered > 0)
+		ring.unsubmitted -= entered;
+	return entered;
+}
+
+// for IORING_OP_POLL_REMOVE, len is the user_data of the poll to remove
+static bool ring_push(unsigned char opcode, unsigned char flags, int fd, void *buf, size_t len, unsigned long long user_data) {
+	unsigned tail = *ring.sq_tail; // only written by us
+	// the chunks are sized so that this does not happen, but a full queue would overwrite entries the kernel has not read yet
+	if(tail - __atomic_load_n(ring.sq_head, __ATOMIC_ACQUIRE) >= ring.entries && ring_enter(0) == -1)
+		return false;
+	unsigned index = tail & *ring.sq_mask;
+	struct io_uring_sqe *sqe = &ring.sqes[index];
+	memset(sqe, 0, sizeof *sqe);
+	sqe->opcode = opcode;
+	sqe->flags = flags;
+	sqe->fd = fd;
+	if(opcode == IORING_OP_POLL_ADD) {
+		sqe->poll32_events = POLLIN;
+	} else if(opcode == IORING_OP_POLL_REMOVE) {
+		sqe->addr = len;
+	} else {
+		sqe->off = (unsigned long long) -1; // current position, pipes and sockets are not seekable anyway
+		sqe->addr = (unsigned long long) (uintptr_t) buf;
+		sqe->len = len;
+	}
+	sqe->user_data = user_data;
+	ring.sq_array[index] = index;
+	__atomic_store_n(ring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+	ring.unsubmitted++;
+	return true;
+}
+
+// user_data of each completion: instance index, and the kind of operation
+enum {
+	UserDataWrite = 0,
+	UserDataPoll = 1,
+	UserDataRead = 2,
+	UserDataExit = 3, // poll of the pidfd
+	UserDataRemove = 4,
+	UserDataBits = 3,
+	UserDataMask = 7,
+};
+
+// per instance of a chunk
+struct ring_slot {
+	size_t written;
+	bool reading, watching; // a read still pending, an exit poll still pending (the other one is removed when either completes)
+};
+
+static bool exchange_chunk(struct snaketongs_impl *const *selves, size_t count, struct ring_slot *slots) {
+	bool ok = true;
+	unsigned submitted = 0;
+	for(size_t i = 0; i < count; i++) {
+		struct snaketongs_impl *self = selves[i];
+		slots[i].written = self->send_len;
+		bool sent = self->send_len && !self->err;
+		bool recv = needs_recv(self, sent);
+		slots[i].reading = recv;
+		slots[i].watching = recv && self->pidfd != -1;
+		if(sent) {
+			// the read starts only after the write completes
+			if(!ring_push(IORING_OP_WRITE, recv ? IOSQE_IO_LINK : 0, self->cpp_to_py, self->send_buf, self->send_len, i << UserDataBits | UserDataWrite))
+				goto error;
+			submitted++;
+			self->send_len = 0;
+		}
+		if(recv) {
+			// the poll makes the read wait even if the pipe is non-blocking
+			self->recv_pos = self->recv_len = 0;
+			if(!ring_push(IORING_OP_POLL_ADD, IOSQE_IO_LINK, self->py_to_cpp, NULL, 0, i << UserDataBits | UserDataPoll))
+				goto error;
+			if(!ring_push(IORING_OP_READ, 0, self->py_to_cpp, self->recv_buf, BufSize, i << UserDataBits | UserDataRead))
+				goto error;
+			submitted += 2;
+		}
+		if(slots[i].watching) {
+			// the child may die while its own children keep the pipe open, the read would never complete
+			if(!ring_push(IORING_OP_POLL_ADD, 0, self->pidfd, NULL, 0, i << UserDataBits | UserDataExit))
+				goto error;
+			submitted++;
+		}
+	}
+	for(unsigned completed = 0; completed < submitted;) {
+		// waits for any completion, not all of them: exit polls only complete after their reads have been handled
+		if(ring_enter(1) == -1)
+			goto error;
+		unsigned head = *ring.cq_head; // only written by us
+		unsigned tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+		for(; head != tail; head++, completed++) {
+			struct io_uring_cqe *cqe = &ring.cqes[head & *ring.cq_mask];
+			size_t i = cqe->user_data >> UserDataBits;
+			struct snaketongs_impl *self = selves[i];
+			struct ring_slot *slot = &slots[i];
+			int res = cqe->res;
+			if((cqe->user_data & UserDataMask) == UserDataPoll || (cqe->user_data & UserDataMask) == UserDataRemove) {
+				// nothing to do, a failed poll cancels the read, a failed removal means the poll has completed already
+			} else if((cqe->user_data & UserDataMask) == UserDataExit) {
+				slot->watching = false;
+				if(res > 0 && slot->reading) {
+					// the child has ended, cancel the read and leave the rest to snaketongs_impl_recv
+					if(!ring_push(IORING_OP_POLL_REMOVE, 0, -1, NULL, i << UserDataBits | UserDataPoll, i << UserDataBits | UserDataRemove))
+						goto error;
+					submitted++;
+				}
+			} else if((cqe->user_data & UserDataMask) == UserDataWrite) {
+				if(res < 0) {
+					errno = -res;
+					perror("snaketongs_impl_send");
+					self->err = true;
+					ok = false;
+				} else if((size_t) res < slot->written) {
+					// short write, the linked read has been cancelled
+					if(!write_all(self, self->send_buf + res, slot->written - res))
+						ok = false;
+				}
+			} else {
+				slot->reading = false;
+				if(slot->watching) {
+					if(!ring_push(IORING_OP_POLL_REMOVE, 0, -1, NULL, i << UserDataBits | UserDataExit, i << UserDataBits | UserDataRemove))
+						goto error;
+					submitted++;
+				}
+				if(res > 0) {
+					self->recv_len = res;
+				} else if(res == -ECANCELED || res == -EAGAIN) {
+					// the write or the poll failed or the write was short, leave the reading to snaketongs_impl_recv
+				} else {
+					if(res < 0) {
+						errno = -res;
+						perror("snaketongs_impl_recv");
+					} else {
+						fputs("snaketongs_impl_recv failed\n", stderr);
+					}
+					self->err = true;
+					ok = false;
+				}
+			}
+		}
+		__atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+	}
+	return ok;
+error:
+	// should not happen with a working ring, we cannot tell which instances are affected
+	perror("snaketongs_impl_exchange_many: io_uring_enter");
+	for(size_t i = 0; i < count; i++)
+		selves[i]->err = true;
+	return false;
+}
+
+bool snaketongs_impl_exchange_many(struct snaketongs_impl *const *selves, size_t count) {
+	// the whole batch is submitted at once unless it exceeds the largest ring, in which case it runs in chunks
+	size_t wanted = count * RingEntriesPerInstance;
+	if(!ring.initialized || (!ring.unavailable && !ring.cannot_grow && ring.entries < wanted && ring.entries < RingMaxEntries)) {
+		if(ring.initialized)
+			ring_free(&ring);
+		ring.initialized = true;
+		// e.g. over RLIMIT_MEMLOCK on older kernels, then the batches keep running in chunks of the smallest ring
+		ring.cannot_grow = !ring_init(wanted);
+		ring.unavailable = ring.cannot_grow && !ring_init(RingMinEntries);
+	}
+	if(ring.unavailable)
+		return exchange_many_fallback(selves, count);
+	size_t max_chunk = ring.entries / RingEntriesPerInstance;
+	size_t num_slots = count < max_chunk ? count : max_chunk;
+	struct ring_slot *slots = (struct ring_slot *) calloc(num_slots ? num_slots : 1, sizeof *slots);
+	if(!slots)
+		return exchange_many_fallback(selves, count);
+	bool ok = true;
+	for(size_t done = 0; done < count; done += max_chunk) {
+		size_t chunk = count - done < max_chunk ? count - done : max_chunk;
+		if(!exchange_chunk(selves + done, chunk, slots))
+			ok = false;
+	}
+	free(slots);
+	return ok;
+}
+
+#else
+
+bool snaketongs_impl_exchange_many(struct snaketongs_impl *const *selves, size_t count) {
+	return exchange_many_fallback(selves, count);
+}
+
+#endif
@@ -1,11 +1,20 @@
 #include <snaketongs.hpp>
 
+#include <chrono>
+#include <csignal>
 #include <cmath>
 #include <cstdio>
 #include <exception>
 #include <iostream>
+#include <map>
+#include <ranges>
 #include <sstream>
+#include <thread>
 #include <typeinfo>
+#include <unordered_map>
+
+#include <sched.h>
+#include <unistd.h>
 
 namespace {
 
@@ -70,6 +79,24 @@ bool have_children() {
 	throw std::runtime_error("ps | awk failed");
 }
 
+// exits with status 3 while a grandchild keeps the pipes open, the grandchild writes its pid to `report` and waits to be killed
+constexpr std::string_view orphaned_pipe_snippet = R"(
+	import os, signal
+	if os.fork() == 0:
+		os.write(report, str(os.getpid()).encode())
+		while True:
+			signal.pause()
+	os._exit(3)
+)";
+
+// checks that the grandchild of orphaned_pipe_snippet is still alive (so its pipes are still open), then kills it
+void kill_orphaned_pipe_holder(int report_fd) {
+	char pid[32] = {};
+	ASSERT(read(report_fd, pid, sizeof pid - 1) > 0);
+	ASSERT(kill(std::atoi(pid), 0) == 0);
+	kill(std::atoi(pid), SIGKILL);
+}
+
 using TEST_cout = std::stringstream;
 
 constexpr auto TEST_endl_expect(std::string_view expected) {
@@ -134,12 +161,125 @@ TEST("proc crash", {
 	ASSERT(not have_children());
 });
 
+TEST("proc death while its pipe is open", {
+	int report[2];
+	ASSERT(pipe(report) == 0); // inherited by the process
+	snaketongs::process proc;
+	try {
+		proc.run_snippet(orphaned_pipe_snippet, snaketongs::kw("report")=report[1]);
+		ASSERT(not "exit returned");
+	} catch(const snaketongs::io_error &e) {
+		ASSERT(std::string_view(e.what()).ends_with("(exited with status 3)"));
+	}
+	ASSERT(proc.exited());
+	kill_orphaned_pipe_holder(report[0]);
+	close(report[0]);
+	close(report[1]);
+});
+
+TEST("proc death while its pipe is open, in exchange", {
+	int report[2];
+	ASSERT(pipe(report) == 0);
+	snaketongs::process procs[2];
+	auto die = procs[0].run_snippet("lambda: exec(__import__('textwrap').dedent(code), {'report': report})", snaketongs::kw("code")=orphaned_pipe_snippet, snaketongs::kw("report")=report[1]);
+	std::vector<snaketongs::pending_call> calls;
+	calls.push_back(die.submit());
+	calls.push_back(procs[1]["math.factorial"].submit(10));
+	snaketongs::exchange(calls);
+	try {
+		calls[0].get();
+		ASSERT(not "exit returned");
+	} catch(const snaketongs::io_error &e) {
+		ASSERT(std::string_view(e.what()).ends_with("(exited with status 3)"));
+	}
+	ASSERT(procs[0].exited());
+	ASSERT_EQ((int) calls[1].get(), 3628800);
+	kill_orphaned_pipe_holder(report[0]);
+	close(report[0]);
+	close(report[1]);
+});
+
 TEST("argv", {
 	snaketongs::process proc;
 	std::string argv_repr = to_string(proc["sys.argv"]);
 	ASSERT_EQ(argv_repr, "['<snaketongs>']");
 });
 
+TEST("cpu affinity", {
+	// pinned, so that the thread cannot migrate to another cache between sampling its CPU and starting the processes
+	cpu_set_t original, current;
+	ASSERT(sched_getaffinity(0, sizeof original, &original) == 0);
+	int cpu = sched_getcpu();
+	CPU_ZERO(&current);
+	CPU_SET(cpu, &current);
+	ASSERT(sched_setaffinity(0, sizeof current, &current) == 0);
+	struct affinity_guard {
+		cpu_set_t &original;
+		~affinity_guard() {
+			sched_setaffinity(0, sizeof original, &original);
+		}
+	} guard{original};
+
+	snaketongs::process pinned({.cpus = {cpu}});
+	ASSERT_EQ(pinned.list(pinned["os.sched_getaffinity"](0)), pinned.make_list(cpu));
+
+	snaketongs::process near({.same_core_complex = true});
+	ASSERT(near["os.sched_getaffinity"](0).contains(cpu));
+
+	try {
+		snaketongs::process invalid({.cpus = {-1}});
+		ASSERT(not "process started");
+	} catch(const snaketongs::io_error &) {}
+});
+
+TEST("gc options", {
+	snaketongs::process disabled({.gc_disabled = true});
+	ASSERT(!disabled["gc.isenabled"]());
+
+	snaketongs::process tuned({.gc_thresholds = {{1000, 20, 30}}});
+	ASSERT(tuned["gc.isenabled"]());
+	ASSERT_EQ(tuned["gc.get_threshold"](), tuned.make_tuple(1000, 20, 30));
+	ASSERT_EQ(to_string(tuned["sys.argv"]), "['<snaketongs>']");
+});
+
+TEST("import cache", {
+	char directory[] = "/tmp/snaketongs-test-XXXXXX";
+	ASSERT(mkdtemp(directory));
+	{
+		snaketongs::process first({.import_cache = directory});
+		first["json.dumps"](1);
+		// aliases (like os.path for posixpath) would be loaded under the wrong name
+		first["sys.modules"].setitem("snaketongs_alias", first["sys.modules"]["json.decoder"]);
+	}
+	snaketongs::process second({.import_cache = directory});
+	auto cache = second["sys.meta_path"][0];
+	ASSERT(cache.attr("locations").get().contains("json.decoder"));
+	ASSERT(not cache.attr("locations").get().contains("snaketongs_alias"));
+	ASSERT_EQ(second["json.dumps"](second.make_list(1)), "[1]");
+	second["shutil.rmtree"](directory);
+});
+
+TEST("resource limits", {
+	snaketongs::process memory_limited({.max_memory = 1ull << 30});
+	try {
+		memory_limited.bytearray(2ull << 30);
+		ASSERT(not "allocation succeeded");
+	} catch(const snaketongs::object &exc) {
+		ASSERT(exc.type().is(memory_limited["builtins.MemoryError"]));
+	}
+
+	snaketongs::process cpu_limited({.max_cpu_seconds = 1});
+	try {
+		cpu_limited.run_snippet("while True: pass");
+		ASSERT(not "infinite loop returned");
+	} catch(const snaketongs::resource_limit_error &) {}
+
+	try {
+		snaketongs::process invalid({.cgroup = "/nonexistent"});
+		ASSERT(not "process started");
+	} catch(const snaketongs::io_error &) {}
+});
+
 TEST("simple strings", {
 	snaketongs::process proc;
 	auto hw = proc.into_object(" ").call("join", proc.make_tuple("hello", "world"));
@@ -195,6 +335,259 @@ TEST("float roundtrip", {
 	inner.operator()<double>();
 });
 
+TEST("ndarray", {
+	snaketongs::process proc;
+
+	std::vector<int> items = {1, 2, 3, 4, 5, 6};
+	auto matrix = proc.make_ndarray(items, {2, 3});
+	ASSERT_EQ(matrix.attr("shape").get(), proc.make_tuple(2, 3));
+	ASSERT_EQ(matrix.call("tolist"), proc.run_snippet("[[1, 2, 3], [4, 5, 6]]"));
+	auto transposed = proc.make_ndarray(items, {3, 2}, {1, 3});
+	ASSERT_EQ(transposed.call("tolist"), proc.run_snippet("[[1, 4], [2, 5], [3, 6]]"));
+
+	struct every_other_column {
+		using element_type = const int;
+		const int *items;
+		std::size_t rank() const { return 2; }
+		std::size_t extent(std::size_t) const { return 2; }
+		std::size_t stride(std::size_t dim) const { return dim == 0 ? 3 : 2; }
+		const int *data_handle() const { return items; }
+	};
+	ASSERT_EQ(proc.make_ndarray(every_other_column{items.data()}).call("tolist"), proc.run_snippet("[[1, 3], [4, 6]]"));
+
+	try {
+		proc.make_ndarray(items, {2, 4});
+		ASSERT(not "shape larger than the items accepted");
+	} catch(const std::out_of_range &) {}
+
+	auto back = matrix.to_ndarray<int>();
+	std::vector<std::size_t> shape = {2, 3};
+	ASSERT(back.shape == shape);
+	ASSERT(back.data == items);
+
+	auto strided = proc.run_snippet("import array\nreturn memoryview(array.array('d', range(6)))[::2]").to_ndarray<double>();
+	std::vector<double> every_other = {0, 2, 4};
+	ASSERT(strided.data == every_other);
+
+	auto longs = proc.run_snippet("import array\nreturn array.array('l', [-1, 2])").to_ndarray<std::int64_t>();
+	ASSERT_EQ(longs.data[0], -1);
+
+	// a memoryview (without numpy) cannot have zeros in its shape
+	auto empty = proc.make_ndarray(std::vector<int>(), {0, 3});
+	ASSERT_EQ(proc.len(empty), 0);
+	ASSERT(empty.to_ndarray<int>().data.empty());
+});
+
+TEST("shared buffer", {
+	snaketongs::process proc;
+
+	snaketongs::shared_buffer<double> buffer = proc.make_shared_buffer<double>(1000);
+	ASSERT_EQ(buffer.size(), 1000u);
+	ASSERT_EQ(proc.len(buffer.array()), 1000);
+	ASSERT_EQ(buffer.array()[999], 0.);
+
+	buffer[3] = 1.5;
+	ASSERT_EQ(buffer.array()[3], 1.5);
+	buffer.array().setitem(4, 2.5);
+	ASSERT_EQ(buffer[4], 2.5);
+
+	// python's mapping outlives the c++ one
+	auto array = buffer.array().dup();
+	{
+		auto moved = std::move(buffer);
+	}
+	ASSERT_EQ(array[3], 1.5);
+
+	try {
+		proc.make_shared_buffer<int>(0);
+		ASSERT(not "empty buffer created");
+	} catch(const std::invalid_argument &) {}
+	try {
+		proc.make_shared_buffer<double>(std::numeric_limits<std::size_t>::max() / 4);
+		ASSERT(not "overflowing buffer created");
+	} catch(const std::length_error &) {}
+});
+
+TEST("columns", {
+	snaketongs::process proc;
+
+	std::vector<double> prices = {1.5, 2.5, 4};
+	std::vector<std::int32_t> counts = {3, 2, 1};
+	auto table = proc.make_columns({{"price", prices}, {"count", counts}});
+	ASSERT_EQ(table["price"].call("tolist"), proc.make_list(1.5, 2.5, 4.));
+	ASSERT_EQ(table["count"].call("tolist"), proc.make_list(3, 2, 1));
+
+	try {
+		proc.make_columns({{"price", prices}, {"count", std::vector<int>{1}}});
+		ASSERT(not "columns of different lengths accepted");
+	} catch(const std::invalid_argument &) {}
+
+	auto [back_counts, back_prices] = table.to_columns<std::int32_t, double>("count", "price");
+	ASSERT(back_counts == counts);
+	ASSERT(back_prices == prices);
+
+	auto empty_table = proc.make_columns({{"price", std::vector<double>()}, {"count", std::vector<std::int32_t>()}});
+	ASSERT_EQ(proc.len(empty_table["price"]), 0);
+	auto [empty_counts] = empty_table.to_columns<std::int32_t>("count");
+	ASSERT(empty_counts.empty());
+
+	try {
+		proc.run_snippet("{'x': [[1]]}").to_columns<double>("x");
+		ASSERT(not "non-buffer column accepted");
+	} catch(const snaketongs::object &) {}
+});
+
+TEST("string lists", {
+	snaketongs::process proc;
+
+	std::vector<std::string> words = {"snake", "", "tongues", "žlutý kůň"};
+	auto list = proc.make_str_list(words);
+	ASSERT_EQ(list, proc.make_list("snake", "", "tongues", "žlutý kůň"));
+	ASSERT_EQ(proc.make_str_list(std::vector<std::string>()), proc.make_list());
+	// temporaries longer than the small string buffer
+	auto repeated = std::views::iota(0, 3) | std::views::transform([](int i) { return std::string(20, 'a' + i); });
+	ASSERT_EQ(proc.make_str_list(repeated), proc.make_list(std::string(20, 'a'), std::string(20, 'b'), std::string(20, 'c')));
+
+	snaketongs::string_list back = list.to_str_list();
+	ASSERT_EQ(back.size(), 4u);
+	for(std::size_t i = 0; i < words.size(); i++)
+		ASSERT_EQ(back[i], words[i]);
+	ASSERT(std::ranges::equal(proc.make_str_list(back).to_str_list().strings(), words));
+	ASSERT_EQ(proc.run_snippet("['a', 'bc']").to_str_list().data, "abc");
+
+	try {
+		proc.make_list("a", 1).to_str_list();
+		ASSERT(not "non-str accepted");
+	} catch(const snaketongs::object &) {}
+});
+
+TEST("reader and writer", {
+	snaketongs::process proc;
+
+	std::string text;
+	for(int i = 0; i < 100; i++)
+		text += "line " + std::to_string(i) + "\n";
+	std::istringstream input(text);
+	auto reader = proc.make_reader(input, 64);
+	ASSERT_EQ(reader.call("readline"), proc.bytes(proc.into_object("line 0\n"), "ascii"));
+	ASSERT_EQ(proc.len(proc.list(reader)), 99);
+	ASSERT_EQ(reader.call("read"), proc.bytes());
+
+	std::ostringstream output;
+	auto writer = proc.make_writer(output, 64);
+	for(int i = 0; i < 100; i++)
+		writer.call("write", proc.bytes(proc.into_object("line " + std::to_string(i) + "\n"), "ascii"));
+	writer.call("close");
+	ASSERT_EQ(output.str(), text);
+
+	std::istringstream pickle_input(std::string(proc["pickle.dumps"](proc.make_list(1, 2, 3)).conv()));
+	ASSERT_EQ(proc["pickle.load"](proc.make_reader(pickle_input)), proc.make_list(1, 2, 3));
+
+	auto failing = proc.make_reader([](std::span<std::byte>) -> std::size_t { throw std::runtime_error("read failed"); });
+	try {
+		failing.call("read");
+		ASSERT(not "exception not propagated");
+	} catch(const std::runtime_error &) {}
+});
+
+TEST("pystreambuf", {
+	snaketongs::process proc;
+
+	auto text = proc.bytes(proc.into_object("first line\nsecond line\n"), "ascii");
+	snaketongs::pystreambuf in_buf(proc["io.BytesIO"](text), 4);
+	std::istream in(&in_buf);
+	std::string first, second, third;
+	std::getline(in, first);
+	std::getline(in, second);
+	ASSERT_EQ(first, "first line");
+	ASSERT_EQ(second, "second line");
+	ASSERT(!std::getline(in, third));
+
+	snaketongs::pystreambuf out_buf(proc["io.BytesIO"](), 8);
+	std::ostream out(&out_buf);
+	out << "x = " << 42 << '\n' << std::string(20, 'y') << std::flush;
+	ASSERT_EQ(out_buf.python_file().call("getvalue"), proc.bytes(proc.into_object("x = 42\n" + std::string(20, 'y')), "ascii"));
+
+	// short writes are repeated, a write that makes no progress fails the stream
+	auto raw_file = proc.run_snippet(R"(
+		import io
+		class RawFile(io.RawIOBase):
+			def __init__(self, limit):
+				self.data = bytearray()
+				self.limit = limit
+			def writable(self):
+				return True
+			def write(self, b):
+				if not self.limit:
+					return None
+				self.data += bytes(b[:self.limit])
+				return min(len(b), self.limit)
+		return RawFile
+	)");
+	snaketongs::pystreambuf short_buf(raw_file(3), 8);
+	std::ostream short_out(&short_buf);
+	short_out << std::string(10, 'a') << "bcd" << std::flush;
+	ASSERT(short_out.good());
+	ASSERT_EQ(proc.bytes(short_buf.python_file().get("data")), proc.bytes(proc.into_object(std::string(10, 'a') + "bcd"), "ascii"));
+
+	snaketongs::pystreambuf stuck_buf(raw_file(0), 8);
+	std::ostream stuck_out(&stuck_buf);
+	stuck_out << "abc" << std::flush;
+	ASSERT(stuck_out.bad());
+
+	try {
+		snaketongs::pystreambuf empty_chunks(proc["io.BytesIO"](), 0);
+		ASSERT(not "zero chunk size accepted");
+	} catch(const std::invalid_argument &) {}
+});
+
+TEST("lazy iterable", {
+	snaketongs::process proc;
+
+	std::vector<int> numbers(2500);
+	for(int i = 0; i < 2500; i++)
+		numbers[i] = i + 1;
+	auto iterable = proc.make_iterable(numbers, 1000);
+	ASSERT_EQ(proc.sum(iterable), 2500 * 2501 / 2);
+	ASSERT_EQ(proc.len(proc.list(iterable)), 2500); // iterable more than once
+
+	auto squares = proc.make_iterable(std::views::iota(0, 5) | std::views::transform([](int i) { return i * i; }));
+	ASSERT_EQ(proc.list(squares), proc.make_list(0, 1, 4, 9, 16));
+
+	// the range may call python while it is iterated
+	auto strs = proc.make_iterable(std::views::iota(0, 3) | std::views::transform([&proc](int i) { return proc.str(i); }));
+	ASSERT_EQ(proc.list(strs), proc.make_list("0", "1", "2"));
+
+	try {
+		proc.make_iterable(numbers, 0);
+		ASSERT(not "zero chunk size accepted");
+	} catch(const std::invalid_argument &) {}
+	ASSERT_EQ(proc.list(proc.make_iterable(std::vector<std::string>{"a", "b"})), proc.make_list("a", "b"));
+	std::vector<snaketongs::object> objects;
+	objects.push_back(proc.None.dup());
+	ASSERT_EQ(proc.list(proc.make_iterable(objects)), proc.make_list(proc.None));
+
+	auto counter = proc.make_iterable(std::views::iota(0), 3);
+	auto it = proc.iter(counter);
+	ASSERT_EQ(proc.next(it), 0);
+	ASSERT_EQ(proc.next(it), 1);
+	ASSERT_EQ(proc.next(it), 2);
+	ASSERT_EQ(proc.next(it), 3);
+});
+
+TEST("pickle", {
+	snaketongs::process proc, other;
+
+	auto obj = proc.run_snippet("import pickle\nreturn [1, 'two', pickle.PickleBuffer(bytearray(b'out of band'))]");
+	snaketongs::pickled p = obj.pickle();
+	ASSERT_EQ(p.buffers.size(), 1u);
+	ASSERT_EQ(p.buffers[0].size(), 11u);
+
+	auto copy = other.unpickle(p);
+	ASSERT_EQ(to_string(copy), "[1, 'two', bytearray(b'out of band')]");
+	ASSERT_EQ(to_string(proc.unpickle(proc.into_object(42).pickle())), "42");
+});
+
 TEST("power", {
 	snaketongs::process proc;
 	{
@@ -369,6 +762,298 @@ TEST("exceptions: py to cpp to py", {
 	ASSERT_EQ((std::string) exc.repr(), "KeyError('nonexistent')");
 });
 
+TEST("augmented assignment", {
+	snaketongs::process proc;
+
+	auto counts = proc.dict();
+	counts.setitem("a", 1);
+	ASSERT_EQ(counts.item("a") += 2, 3);
+	ASSERT_EQ(counts.item("a").ipow(2), 9);
+	ASSERT_EQ(counts["a"], 9);
+
+	// in-place operator result is assigned back, as in Python
+	auto lists = proc.make_list(proc.make_list(1));
+	auto inner = lists[0];
+	lists.item(0) += proc.make_list(2);
+	ASSERT(lists[0].is(inner));
+	ASSERT_EQ(to_string(lists), "[[1, 2]]");
+
+	auto ns = proc["types.SimpleNamespace"]();
+	ns.set("text", "x");
+	ns.attr("text") *= 3;
+	ASSERT_EQ(ns.get("text"), "xxx");
+});
+
+TEST("bulk dict and attributes", {
+	snaketongs::process proc;
+
+	std::map<std::string, int> counts = {{"a", 1}, {"b", 2}};
+	auto dict = proc.make_dict(counts);
+	ASSERT_EQ(to_string(dict), "{'a': 1, 'b': 2}");
+
+	auto key = proc.make_tuple(1, 2);
+	std::vector<std::pair<const snaketongs::object &, double>> mixed = {{key, 0.5}};
+	dict.update_from(mixed);
+	ASSERT_EQ(to_string(dict), "{'a': 1, 'b': 2, (1, 2): 0.5}");
+
+	// not encodable inline, converted before the command is sent
+	std::vector<std::pair<std::string, std::function<int(int)>>> fns = {{"twice", [](int x) { return 2*x; }}};
+	dict.update_from(fns);
+	ASSERT_EQ(dict["twice"](21), 42);
+
+	auto ns = proc["types.SimpleNamespace"]();
+	std::vector<std::tuple<std::string_view, bool>> flags = {{"x", true}, {"y", false}};
+	ns.set_many(flags);
+	ASSERT_EQ(to_string(ns), "namespace(x=True, y=False)");
+
+	// unhashable key, the whole command still has to be consumed
+	std::vector<std::pair<const snaketongs::object &, int>> bad = {{dict, 1}};
+	try {
+		proc.make_dict(bad);
+		ASSERT(not "make_dict returned");
+	} catch(const snaketongs::object &exc) {
+		ASSERT_EQ(exc.type().get("__name__"), "TypeError");
+	}
+
+	// c++ exception while sending
+	auto throwing = std::views::iota(0, 3) | std::views::transform([](int i) {
+		if(i == 2)
+			throw std::out_of_range("test");
+		return std::pair(i, i);
+	});
+	try {
+		proc.make_dict(throwing);
+		ASSERT(not "make_dict returned");
+	} catch(const std::out_of_range &) {}
+	ASSERT_EQ(to_string(proc.make_dict(std::views::iota(0, 2) | std::views::transform([](int i) { return std::pair(i, i); }))), "{0: 0, 1: 1}");
+});
+
+TEST("get many attributes", {
+	snaketongs::process proc;
+
+	using snaketongs::kw;
+	auto ns = proc["types.SimpleNamespace"](kw("x")=true, kw("y")=false);
+	auto [x, y] = ns.get_many({"x", "y"});
+	ASSERT(x.is(proc.True));
+	ASSERT(y.is(proc.False));
+	std::vector<std::string_view> names = {"y", "x", "y"};
+	ASSERT_EQ(ns.get_many(names).size(), 3u);
+	try {
+		ns.get_many({"x", "z"});
+		ASSERT(not "get_many returned");
+	} catch(const snaketongs::object &exc) {
+		ASSERT_EQ(exc.type().get("__name__"), "AttributeError");
+	}
+});
+
+TEST("hash and len", {
+	snaketongs::process proc;
+
+	auto key = proc.make_tuple("a", 1);
+	ASSERT_EQ(key.hash(), (snaketongs::object) proc.hash(key));
+	ASSERT_EQ(key.hash(), key.hash()); // cached
+	ASSERT_EQ(key.len(), 2);
+
+	auto list = proc.make_list(1, 2, 3);
+	ASSERT_EQ(list.len(), 3);
+	list.call("append", 4);
+	ASSERT_EQ(list.len(), 4);
+	try {
+		list.hash();
+		ASSERT(not "hash returned");
+	} catch(const snaketongs::object &exc) {
+		ASSERT_EQ(exc.type().get("__name__"), "TypeError");
+	}
+
+	std::unordered_map<snaketongs::object, int> map;
+	map.emplace(proc.into_object("x"), 1);
+	map.emplace(proc.into_object(2), 2);
+	ASSERT_EQ(map.at(proc.into_object("x")), 1);
+	ASSERT_EQ(map.at(proc.into_object(2)), 2);
+});
+
+TEST("conversion cache", {
+	snaketongs::process proc;
+	proc.cache_conversions(true);
+
+	auto config = proc.make_dict(std::map<std::string, std::string>{{"name", "value"}});
+	auto name = config["name"];
+	ASSERT_EQ((std::string) name, "value");
+	ASSERT_EQ((std::string) name, "value");
+	ASSERT_EQ(std::string_view(std::vector<char>(name).data(), 5), "value");
+
+	auto number = proc.into_object(1.5);
+	ASSERT_EQ((double) number, 1.5);
+	ASSERT_EQ((float) number, 1.5f);
+
+	// the remote index is reused after being released, the cached value must not be
+	for(int i = 0; i < 10; i++) {
+		auto obj = proc.into_object(i);
+		ASSERT_EQ((int) obj, i);
+		ASSERT_EQ((int) obj, i);
+	}
+
+	proc.cache_conversions(false);
+	ASSERT_EQ((std::string) name, "value");
+	ASSERT_EQ((double) number, 1.5);
+});
+
+TEST("snippets", {
+	using snaketongs::kw;
+	snaketongs::process proc;
+
+	auto list = proc.make_list(3, 1, 2);
+	ASSERT_EQ(proc.run_snippet("sorted(x)[-1] + y", kw("x")=list, kw("y")=10), 13);
+	ASSERT_EQ(proc.run_snippet("sorted(x)[-1] + y", kw("x")=list, kw("y")=20), 23);
+	ASSERT_EQ(proc.run_snippet("x * 2", kw("x")="ab"), "abab");
+	ASSERT(proc.run_snippet("None").is(proc.None));
+
+	ASSERT_EQ(proc.run_snippet(R"(
+		import collections
+		counter = collections.Counter(words.split())
+		return counter.most_common(1)[0][0]
+	)", kw("words")="a b a c"), "a");
+
+	ASSERT(proc.run_snippet("x.append(1)", kw("x")=list).is(proc.None));
+	ASSERT_EQ(list.len(), 4);
+
+	// not inline, converted before the command
+	ASSERT_EQ(proc.run_snippet("f(20)", kw("f")=[](int x) { return x + 1; }), 21);
+
+	ASSERT_EQ(proc.run_snippet("x + 1  # comment", kw("x")=1), 2);
+	ASSERT_EQ(proc.run_snippet("text = '''a\n  b'''\nreturn text"), "a\n  b"); // string literals are left as they are
+
+	try {
+		proc.run_snippet("return x +", kw("x")=1);
+		ASSERT(not "run_snippet returned");
+	} catch(const snaketongs::object &exc) {
+		ASSERT_EQ(exc.type().get("__name__"), "SyntaxError");
+	}
+});
+
+TEST("submit and exchange", {
+	snaketongs::process procs[3];
+
+	std::vector<snaketongs::pending_call> calls;
+	for(int i = 0; i < 3; i++)
+		calls.push_back(procs[i]["math.factorial"].submit(10 + i));
+	snaketongs::exchange(calls);
+	ASSERT_EQ((int) calls[0].get(), 3628800);
+	ASSERT_EQ((long long) calls[2].get(), 479001600);
+	ASSERT_EQ((long long) calls[1].get(), 39916800);
+	ASSERT(!calls[0].valid());
+
+	// callbacks are handled by get(), exceptions are thrown by it
+	auto call = procs[0].map.submit([](int x) { return x * 2; }, procs[0].make_list(1, 2));
+	auto doubled = call.get();
+	ASSERT_EQ(procs[0].list(doubled), procs[0].make_list(2, 4));
+	calls.clear();
+	calls.push_back(procs[1]["math.sqrt"].submit(-1));
+	calls.push_back(procs[2].len.submit(5));
+	snaketongs::exchange(calls);
+	for(auto &c : calls) {
+		try {
+			c.get();
+			ASSERT(not "get returned");
+		} catch(const snaketongs::object &exc) {
+			auto name = (std::string) exc.type().get("__name__");
+			ASSERT(name == "ValueError" || name == "TypeError");
+		}
+	}
+
+	// an abandoned call keeps the process usable
+	procs[2].len.submit("abc");
+	ASSERT_EQ(procs[2].len("ab"), 2);
+});
+
+TEST("exchange with many processes", {
+	// more processes than fit in the smallest ring, each call only returns true once all of them have been received
+	constexpr int count = 65;
+	snaketongs::process procs[count];
+	char directory[] = "/tmp/snaketongs-test-XXXXXX";
+	ASSERT(mkdtemp(directory));
+	std::vector<snaketongs::pending_call> calls;
+	for(auto &proc : procs) {
+		auto arrive = proc.run_snippet(R"(
+			import os, time
+			def arrive(directory, count):
+				open(os.path.join(directory, str(os.getpid())), 'w').close()
+				deadline = time.monotonic() + 10
+				while len(os.listdir(directory)) < count:
+					if time.monotonic() > deadline:
+						return False
+					time.sleep(0.01)
+				return True
+			return arrive
+		)");
+		calls.push_back(arrive.submit(directory, count));
+	}
+	snaketongs::exchange(calls);
+	int arrived = 0;
+	for(auto &call : calls)
+		arrived += (bool) call.get();
+	procs[0]["shutil.rmtree"](directory);
+	ASSERT_EQ(arrived, count);
+});
+
+TEST("gc pause", {
+	snaketongs::process proc;
+	auto gc_enabled = proc["gc.isenabled"];
+	{
+		snaketongs::gc_pause pause(proc);
+		ASSERT(!gc_enabled());
+		{
+			snaketongs::gc_pause inner(proc, true);
+			ASSERT(!gc_enabled());
+		}
+		ASSERT(!gc_enabled());
+	}
+	ASSERT(gc_enabled());
+
+	// stays disabled if it was disabled before, but still collects
+	auto full_collections = [&] { return (int) proc["gc.get_stats"]()[2]["collections"]; };
+	int before = full_collections();
+	proc["gc.disable"]();
+	{
+		snaketongs::gc_pause pause(proc, true);
+	}
+	ASSERT(!gc_enabled());
+	ASSERT_EQ(full_collections(), before + 1);
+});
+
+TEST("init script", {
+	using snaketongs::kw;
+	snaketongs::init_script script;
+	script
+		.global("json", "json.*")
+		.call("counter", "collections.Counter", "abracadabra")
+		.snippet("top", "counter.most_common(n)[0][0]", kw("n")=1)
+		.snippet("encoded", "json.dumps([top, scale * 2])", kw("scale")=1.5);
+
+	for(int i = 0; i < 2; i++) {
+		snaketongs::process proc;
+		auto results = proc.run_init_script(script);
+		ASSERT_EQ(results["top"], "a");
+		ASSERT_EQ(results["encoded"], "[\"a\", 3.0]");
+		ASSERT_EQ(proc["snaketongs_init.counter"]["b"], 2);
+	}
+
+	snaketongs::init_script failing;
+	failing.call("x", "builtins.int", "not a number");
+	snaketongs::process proc;
+	try {
+		proc.run_init_script(failing);
+		ASSERT(not "init script succeeded");
+	} catch(const snaketongs::object &exc) {
+		ASSERT(exc.type().is(proc["builtins.ValueError"]));
+	}
+
+	snaketongs::pool pool({.max_calls = 1, .init = script});
+	for(int i = 0; i < 2; i++)
+		ASSERT_EQ((*pool.acquire())["snaketongs_init.top"], "a");
+	ASSERT(pool.recycled() > 0);
+});
+
 TEST("with", {
 	using snaketongs::kw;
 	snaketongs::process proc;
@@ -484,6 +1169,110 @@ TEST("with", {
 	log.str("");
 });
 
+TEST("server", {
+	std::string socket_path = "/tmp/snaketongs-test-" + std::to_string(getpid()) + ".sock";
+	std::string pid_path = socket_path + ".pid";
+	std::system(("${PYTHON:-python3} entry.py --serve " + socket_path + " json gc=2000,10,10 >/dev/null & echo $! > " + pid_path).c_str());
+	struct server_guard {
+		const std::string &pid_path;
+		~server_guard() {
+			std::system(("kill $(cat " + pid_path + ") && rm " + pid_path).c_str());
+		}
+	} guard{pid_path};
+	for(int i = 0; i < 100 && access(socket_path.c_str(), F_OK); i++)
+		std::system("sleep .1 || sleep 1");
+
+	{
+		snaketongs::process a(snaketongs::server_socket(socket_path.c_str()));
+		snaketongs::process b(snaketongs::server_socket(socket_path.c_str()));
+		ASSERT(not have_children());
+
+		// separate sessions forked from the same server
+		ASSERT((int) a["os.getpid"]() != (int) b["os.getpid"]());
+		ASSERT_EQ((int) a["os.getppid"](), (int) b["os.getppid"]());
+		ASSERT(a.run_snippet("'json' in __import__('sys').modules"));
+		ASSERT((int) a["gc.get_freeze_count"]() > 0);
+		ASSERT_EQ((int) b["gc.get_threshold"]().getitem(0), 2000);
+
+		a["json.*"].set("marker", 1);
+		ASSERT(a["json.*"].hasattr("marker"));
+		ASSERT(not b["json.*"].hasattr("marker"));
+		ASSERT_EQ(to_string(b["sys.argv"]), "['<snaketongs>']");
+
+		// the sockets of the sessions are not inherited by interpreters started afterwards
+		snaketongs::process local;
+		ASSERT(not local.run_snippet(R"(
+			import os
+			def target(fd):
+				try:
+					return os.readlink('/proc/self/fd/' + fd)
+				except OSError:
+					return ''
+			return [fd for fd in os.listdir('/proc/self/fd') if int(fd) > 2 and target(fd).startswith('socket:')]
+		)"));
+		a.terminate();
+	}
+});
+
+TEST("pool", {
+	snaketongs::pool pool({
+		.size = 2,
+		.max_calls = 20,
+		.warm_up = [](snaketongs::process &proc) {
+			proc["json.dumps"];
+		},
+	});
+
+	{
+		auto a = pool.acquire();
+		auto b = pool.acquire();
+		ASSERT((int) (*a)["os.getpid"]() != (int) (*b)["os.getpid"]());
+		ASSERT(a->resident_memory().value_or(0) > 0);
+		ASSERT(a->run_snippet("'json' in __import__('sys').modules"));
+	}
+
+	int pid = (int) (*pool.acquire())["os.getpid"]();
+	for(int i = 0; i < 10; i++) {
+		auto l = pool.acquire();
+		auto sum = l->sum(l->make_list(1, 2, 3));
+		ASSERT_EQ(sum, 6);
+	}
+	ASSERT(pool.recycled() > 0);
+	auto a = pool.acquire();
+	auto b = pool.acquire();
+	ASSERT((int) (*a)["os.getpid"]() != pid && (int) (*b)["os.getpid"]() != pid);
+});
+
+TEST("pool from threads", {
+	snaketongs::pool pool({.size = 2, .max_calls = 30});
+	std::vector<std::thread> threads;
+	std::vector<int> sums(4);
+	for(int t = 0; t < 4; t++) {
+		threads.emplace_back([&pool, &sums, t] {
+			for(int i = 0; i < 5; i++) {
+				auto l = pool.acquire();
+				std::vector<snaketongs::pending_call> calls;
+				calls.push_back((*l).sum.submit(l->make_list(t, i)));
+				snaketongs::exchange(calls);
+				sums[t] += (int) calls[0].get();
+			}
+		});
+	}
+	for(auto &thread : threads)
+		thread.join();
+	for(int t = 0; t < 4; t++)
+		ASSERT_EQ(sums[t], 5 * t + 10);
+	ASSERT(pool.recycled() > 0);
+});
+
+TEST("pool memory limit", {
+	snaketongs::pool pool({.max_resident_memory = 1});
+	int pid = (int) (*pool.acquire())["os.getpid"]();
+	ASSERT_EQ(pool.recycled(), 1u);
+	ASSERT((int) (*pool.acquire())["os.getpid"]() != pid);
+	ASSERT_EQ(pool.recycled(), 2u);
+});
+
 TEST("readme: intro", {
 	// Start a process by creating a `snaketongs::process` object.
 	// (The process will be terminated when it goes out of scope.)